@@ -92,3 +92,23 @@ void *memcpy(void *dest, const void *src, size_t n)
 
 	return dest;
 }
+
+void *memmove(void *dest, const void *src, size_t n)
+{
+	unsigned long d0, d1, d2;
+
+	/* Copying forward is safe unless dest overlaps the end of src. */
+	if (dest <= src || dest >= src + n)
+		return memcpy(dest, src, n);
+
+	asm volatile(
+		"std\n\t"
+		"rep ; movsb\n\t"
+		"cld\n\t"
+		: "=&c" (d0), "=&D" (d1), "=&S" (d2)
+		: "0" (n), "1" (dest + n - 1), "2" (src + n - 1)
+		: "memory"
+	);
+
+	return dest;
+}
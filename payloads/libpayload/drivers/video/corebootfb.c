@@ -61,48 +61,117 @@ static const u32 vga_colors[] = {
 };
 
 static struct cb_framebuffer fbinfo;
+
+/*
+ * Text cells are kept in a ring of rows so that scrolling only has to advance
+ * first_row and blank one row. Rendering to the framebuffer is deferred until
+ * corebootfb_flush(): by then, any number of scrolls collapse into at most one
+ * move of the framebuffer contents, and only the cells that changed since the
+ * last flush (tracked per physical row as a [start, end) column range) get
+ * their glyphs drawn.
+ */
 static unsigned short *chars;
+static unsigned int first_row;
+static unsigned int pending_scroll;
+static unsigned short *dirty_start, *dirty_end;
+/* Columns of each on-screen text line that may hold non-background pixels. */
+static unsigned short *fb_used;
+
+#define ROWS	(coreboot_video_console.rows)
+#define COLUMNS	(coreboot_video_console.columns)
+
+/* Physical row in |chars| of the given on-screen row. */
+static inline unsigned int ring_row(unsigned int row)
+{
+	return (first_row + row) % ROWS;
+}
+
+static inline unsigned short *cell(unsigned int row, unsigned int col)
+{
+	return &chars[ring_row(row) * COLUMNS + col];
+}
+
+static void mark_dirty(unsigned int row, unsigned int start, unsigned int end)
+{
+	const unsigned int r = ring_row(row);
+
+	if (dirty_start[r] >= dirty_end[r]) {
+		dirty_start[r] = start;
+		dirty_end[r] = end;
+		return;
+	}
+	dirty_start[r] = MIN(dirty_start[r], start);
+	dirty_end[r] = MAX(dirty_end[r], end);
+}
+
+static void clear_row(unsigned int row)
+{
+	unsigned short *ptr = cell(row, 0);
+	int column;
+
+	for (column = 0; column < COLUMNS; column++)
+		ptr[column] = (VGA_COLOR_DEFAULT << 8);
+}
 
 /* Shorthand for up-to-date virtual framebuffer address */
 #define FB ((unsigned char *)phys_to_virt(fbinfo.physical_address))
 
 static void corebootfb_scroll_up(void)
 {
-	unsigned char *dst = FB;
-	unsigned char *src = FB + (fbinfo.bytes_per_line * font_height);
-	int y;
+	const unsigned int r = ring_row(0);
 
-	/* Scroll all lines up */
-	for (y = 0; y < fbinfo.y_resolution - font_height; y++) {
-		memcpy(dst, src, fbinfo.x_resolution * (fbinfo.bits_per_pixel >> 3));
+	/* The old top row becomes the new, empty bottom row. */
+	first_row = (first_row + 1) % ROWS;
+	clear_row(ROWS - 1);
+	dirty_start[r] = dirty_end[r] = 0;
+	if (pending_scroll < ROWS)
+		pending_scroll++;
 
-		dst += fbinfo.bytes_per_line;
-		src += fbinfo.bytes_per_line;
-	}
+	cursor_y--;
+}
 
-	/* Erase last line */
-	dst = FB + (fbinfo.y_resolution - font_height) * fbinfo.bytes_per_line;
+/*
+ * Move the framebuffer contents up for all scrolls since the last flush. Only
+ * the part of each text line that has ever been drawn to (see fb_used) is
+ * moved; everything to the right of it is known to be background.
+ */
+static void corebootfb_flush_scroll(void)
+{
+	const int bytes = fbinfo.bits_per_pixel >> 3;
+	const unsigned int bpl = fbinfo.bytes_per_line;
+	const unsigned int shift = pending_scroll;
+	unsigned int row, y, width;
+	unsigned char *dst;
 
-	for (; y < fbinfo.y_resolution; y++) {
-		memset(dst, 0, fbinfo.x_resolution * (fbinfo.bits_per_pixel >> 3));
-		dst += fbinfo.bytes_per_line;
+	for (row = 0; row < ROWS; row++) {
+		if (row + shift < ROWS) {
+			width = MAX(fb_used[row], fb_used[row + shift]);
+			fb_used[row] = fb_used[row + shift];
+		} else {
+			width = fb_used[row];
+			fb_used[row] = 0;
+		}
+		if (!width)
+			continue;
+
+		/* Glyphs start one pixel into their cell. */
+		width = MIN(width * font_width + 1, fbinfo.x_resolution) * bytes;
+		dst = FB + row * font_height * bpl;
+		for (y = 0; y < font_height; y++, dst += bpl) {
+			if (row + shift < ROWS)
+				memmove(dst, dst + shift * font_height * bpl,
+					width);
+			else
+				memset(dst, 0, width);
+		}
 	}
 
-	/* And update the char buffer */
-	dst = (unsigned char *)chars;
-	src = (unsigned char *)(chars + coreboot_video_console.columns);
-	memcpy(dst, src, coreboot_video_console.columns *
-			(coreboot_video_console.rows - 1) * 2);
-	int column;
-	for (column = 0; column < coreboot_video_console.columns; column++)
-		chars[(coreboot_video_console.rows - 1) * coreboot_video_console.columns + column] = (VGA_COLOR_DEFAULT << 8);
-
-	cursor_y--;
+	pending_scroll = 0;
 }
 
 static void corebootfb_clear(void)
 {
-	int row, column;
+	int row;
 	unsigned char *ptr = FB;
 
 	/* Clear the screen */
@@ -112,9 +181,13 @@ static void corebootfb_clear(void)
 	}
 
 	/* And update the char buffer */
-	for(row = 0; row < coreboot_video_console.rows; row++)
-		for (column = 0; column < coreboot_video_console.columns; column++)
-			chars[row * coreboot_video_console.columns + column] = (VGA_COLOR_DEFAULT << 8);
+	first_row = 0;
+	pending_scroll = 0;
+	for (row = 0; row < ROWS; row++) {
+		clear_row(row);
+		dirty_start[row] = dirty_end[row] = 0;
+		fb_used[row] = 0;
+	}
 }
 
 static void corebootfb_putchar(u8 row, u8 col, unsigned int ch)
@@ -124,10 +197,9 @@ static void corebootfb_putchar(u8 row, u8 col, unsigned int ch)
 	unsigned char bg = (ch >> 12) & 0xF;
 	unsigned char fg = (ch >> 8) & 0xF;
 	u32 fgval = 0, bgval = 0;
-	u16 *dst16;
-	u32 *dst32;
+	const int bytes = fbinfo.bits_per_pixel >> 3;
 
-	int x, y;
+	int x, y, s;
 
 	if (fbinfo.bits_per_pixel > 8) {
 		bgval = ((((vga_colors[bg] >> 0) & 0xff) >> (8 - fbinfo.blue_mask_size)) << fbinfo.blue_mask_pos) |
@@ -138,35 +210,42 @@ static void corebootfb_putchar(u8 row, u8 col, unsigned int ch)
 			((((vga_colors[fg] >> 16) & 0xff) >> (8 - fbinfo.red_mask_size)) << fbinfo.red_mask_pos);
 	}
 
+	if (fbinfo.bits_per_pixel == 8) { /* Indexed */
+		fgval = fg;
+		bgval = bg;
+	}
+
 	dst = FB + ((row * font_height) * fbinfo.bytes_per_line);
-	dst += (col * font_width * (fbinfo.bits_per_pixel >> 3));
-
-	for(y = 0; y < font_height; y++) {
-		for(x = font_width - 1; x >= 0; x--) {
-
-			switch (fbinfo.bits_per_pixel) {
-			case 8: /* Indexed */
-				dst[(font_width - x) * (fbinfo.bits_per_pixel >> 3)] = font_glyph_filled(ch, x, y) ?  fg : bg;
-				break;
-			case 16: /* 16 bpp */
-				dst16 = (u16 *)(dst + (font_width - x) * (fbinfo.bits_per_pixel >> 3));
-				*dst16 = font_glyph_filled(ch, x, y) ? fgval : bgval;
-				break;
-			case 24: /* 24 bpp */
-				if (font_glyph_filled(ch, x, y)) {
-					dst[(font_width - x) * (fbinfo.bits_per_pixel >> 3) + 0] = fgval & 0xff;
-					dst[(font_width - x) * (fbinfo.bits_per_pixel >> 3) + 1] = (fgval >> 8) & 0xff;
-					dst[(font_width - x) * (fbinfo.bits_per_pixel >> 3) + 2] = (fgval >> 16) & 0xff;
-				} else {
-					dst[(font_width - x) * (fbinfo.bits_per_pixel >> 3) + 0] = bgval & 0xff;
-					dst[(font_width - x) * (fbinfo.bits_per_pixel >> 3) + 1] = (bgval >> 8) & 0xff;
-					dst[(font_width - x) * (fbinfo.bits_per_pixel >> 3) + 2] = (bgval >> 16) & 0xff;
+	dst += (col * font_width * bytes);
+
+	/*
+	 * Fetch each glyph row once and emit every glyph column font_scale
+	 * times, starting one pixel into the cell.
+	 */
+	for (y = 0; y < font_height; y++) {
+		const unsigned char bits = font_glyph_row(ch, y);
+		unsigned char *pixel = dst + bytes;
+
+		for (x = FONT_WIDTH - 1; x >= 0; x--) {
+			const u32 val = bits & (1 << x) ? fgval : bgval;
+
+			for (s = 0; s < font_scale; s++, pixel += bytes) {
+				switch (bytes) {
+				case 1:
+					*pixel = val;
+					break;
+				case 2:
+					*(u16 *)pixel = val;
+					break;
+				case 3:
+					pixel[0] = val & 0xff;
+					pixel[1] = (val >> 8) & 0xff;
+					pixel[2] = (val >> 16) & 0xff;
+					break;
+				case 4:
+					*(u32 *)pixel = val;
+					break;
 				}
-				break;
-			case 32: /* 32 bpp */
-				dst32 = (u32 *)(dst + (font_width - x) * (fbinfo.bits_per_pixel >> 3));
-				*dst32 = font_glyph_filled(ch, x, y) ? fgval : bgval;
-				break;
 			}
 		}
 
@@ -176,22 +255,39 @@ static void corebootfb_putchar(u8 row, u8 col, unsigned int ch)
 
 static void corebootfb_putc(u8 row, u8 col, unsigned int ch)
 {
-	chars[row * coreboot_video_console.columns + col] = ch;
-	corebootfb_putchar(row, col, ch);
+	*cell(row, col) = ch;
+	mark_dirty(row, col, col + 1);
 }
 
-static void corebootfb_update_cursor(void)
+/* Draw everything that changed since the last flush. */
+static void corebootfb_flush(void)
 {
-	int ch, paint;
-	if(cursor_en) {
-		ch = chars[cursor_y * coreboot_video_console.columns + cursor_x];
-		paint = (ch & 0xff) | ((ch << 4) & 0xf000) | ((ch >> 4) & 0x0f00);
-	} else {
-		paint = chars[cursor_y * coreboot_video_console.columns + cursor_x];
+	unsigned int row, col, r;
+	unsigned int ch;
+
+	if (pending_scroll)
+		corebootfb_flush_scroll();
+
+	for (row = 0; row < ROWS; row++) {
+		r = ring_row(row);
+		for (col = dirty_start[r]; col < dirty_end[r]; col++) {
+			ch = *cell(row, col);
+			/* Swap foreground and background under the cursor. */
+			if (cursor_en && row == cursor_y && col == cursor_x)
+				ch = (ch & 0xff) | ((ch << 4) & 0xf000) |
+				     ((ch >> 4) & 0x0f00);
+			corebootfb_putchar(row, col, ch);
+		}
+		if (dirty_end[r] > fb_used[row])
+			fb_used[row] = dirty_end[r];
+		dirty_start[r] = dirty_end[r] = 0;
 	}
+}
 
-	if (cursor_y < coreboot_video_console.rows)
-		corebootfb_putchar(cursor_y, cursor_x, paint);
+static void corebootfb_update_cursor(void)
+{
+	if (cursor_y < ROWS && cursor_x < COLUMNS)
+		mark_dirty(cursor_y, cursor_x, cursor_x + 1);
 }
 
 static void corebootfb_enable_cursor(int state)
@@ -209,15 +305,13 @@ static void corebootfb_get_cursor(unsigned int *x, unsigned int *y, unsigned int
 
 static void corebootfb_set_cursor(unsigned int x, unsigned int y)
 {
-	int cursor_remember = cursor_en;
-	if (cursor_remember)
-		corebootfb_enable_cursor(0);
+	/* Both the old and the new position need a redraw. */
+	corebootfb_update_cursor();
 
 	cursor_x = x;
 	cursor_y = y;
 
-	if (cursor_remember)
-		corebootfb_enable_cursor(1);
+	corebootfb_update_cursor();
 }
 
 static int corebootfb_init(void)
@@ -242,8 +336,16 @@ static int corebootfb_init(void)
 
 	chars = malloc(coreboot_video_console.rows *
 		       coreboot_video_console.columns * 2);
-	if (!chars)
+	dirty_start = malloc(coreboot_video_console.rows * 2);
+	dirty_end = malloc(coreboot_video_console.rows * 2);
+	fb_used = malloc(coreboot_video_console.rows * 2);
+	if (!chars || !dirty_start || !dirty_end || !fb_used) {
+		free(chars);
+		free(dirty_start);
+		free(dirty_end);
+		free(fb_used);
 		return -1;
+	}
 
 	// clear boot splash screen if there is one.
 	corebootfb_clear();
@@ -266,6 +368,7 @@ struct video_console coreboot_video_console = {
 	.putc = corebootfb_putc,
 	.clear = corebootfb_clear,
 	.scroll_up = corebootfb_scroll_up,
+	.flush = corebootfb_flush,
 
 	.get_cursor = corebootfb_get_cursor,
 	.set_cursor = corebootfb_set_cursor,
@@ -43,6 +43,16 @@ static struct rect screen;
 
 static uint8_t *gfx_buffer;
 
+/*
+ * Regions of the screen (in canvas orientation, not framebuffer orientation)
+ * that were drawn to since the last flush_graphics_buffer(). Only these are
+ * copied to the real framebuffer. When more than DAMAGE_RECTS separate regions
+ * are touched, the two that grow the least when combined get merged.
+ */
+#define DAMAGE_RECTS	8
+static struct rect damage[DAMAGE_RECTS];
+static int damage_count;
+
 /*
  * Framebuffer is assumed to assign a higher coordinate (larger x, y) to
  * a higher address
@@ -355,6 +365,94 @@ static int cbgfx_init(void)
 	return 0;
 }
 
+static void union_rect(struct rect *out, const struct rect *r1,
+		       const struct rect *r2)
+{
+	int32_t x0 = MIN(r1->offset.x, r2->offset.x);
+	int32_t y0 = MIN(r1->offset.y, r2->offset.y);
+	int32_t x1 = MAX(r1->offset.x + r1->size.width,
+			 r2->offset.x + r2->size.width);
+	int32_t y1 = MAX(r1->offset.y + r1->size.height,
+			 r2->offset.y + r2->size.height);
+
+	out->offset.x = x0;
+	out->offset.y = y0;
+	out->size.width = x1 - x0;
+	out->size.height = y1 - y0;
+}
+
+static int64_t rect_area(const struct rect *r)
+{
+	return (int64_t)r->size.width * r->size.height;
+}
+
+/*
+ * Record that the area from |top_left| (inclusive) to |bottom_right|
+ * (exclusive) was drawn to. This is a no-op when drawing directly to the
+ * framebuffer.
+ */
+static void add_damage(const struct vector *top_left,
+		       const struct vector *bottom_right)
+{
+	struct rect r, u;
+	int i, j, best_i = 0, best_j = 0;
+	int64_t cost, best_cost = INT64_MAX;
+
+	if (!gfx_buffer)
+		return;
+
+	r.offset.x = MAX(top_left->x, 0);
+	r.offset.y = MAX(top_left->y, 0);
+	r.size.width = MIN(bottom_right->x, screen.size.width) - r.offset.x;
+	r.size.height = MIN(bottom_right->y, screen.size.height) - r.offset.y;
+	if (r.size.width <= 0 || r.size.height <= 0)
+		return;
+
+	/* Fold into an existing region if that doesn't grow it. */
+	for (i = 0; i < damage_count; i++) {
+		union_rect(&u, &damage[i], &r);
+		if (rect_area(&u) <= rect_area(&damage[i]) + rect_area(&r)) {
+			damage[i] = u;
+			return;
+		}
+	}
+
+	if (damage_count < DAMAGE_RECTS) {
+		damage[damage_count++] = r;
+		return;
+	}
+
+	/* Out of slots: merge the cheapest pair, counting |r| as the last. */
+	for (i = 0; i < DAMAGE_RECTS; i++) {
+		for (j = i + 1; j <= DAMAGE_RECTS; j++) {
+			const struct rect *rj = j < DAMAGE_RECTS ?
+						&damage[j] : &r;
+			union_rect(&u, &damage[i], rj);
+			cost = rect_area(&u) - rect_area(&damage[i]) -
+			       rect_area(rj);
+			if (cost < best_cost) {
+				best_cost = cost;
+				best_i = i;
+				best_j = j;
+			}
+		}
+	}
+	union_rect(&damage[best_i], &damage[best_i],
+		   best_j < DAMAGE_RECTS ? &damage[best_j] : &r);
+	if (best_j < DAMAGE_RECTS)
+		damage[best_j] = r;
+}
+
+static void add_damage_screen(void)
+{
+	const struct vector bottom_right = {
+		.x = screen.size.width,
+		.y = screen.size.height,
+	};
+
+	add_damage(&vzero, &bottom_right);
+}
+
 int draw_box(const struct rect *box, const struct rgb_color *rgb)
 {
 	struct vector top_left;
@@ -380,6 +478,7 @@ int draw_box(const struct rect *box, const struct rgb_color *rgb)
 		return CBGFX_ERROR_BOUNDARY;
 	}
 
+	add_damage(&top_left, &t);
 	for (p.y = top_left.y; p.y < t.y; p.y++)
 		for (p.x = top_left.x; p.x < t.x; p.x++)
 			set_pixel(&p, color);
@@ -443,6 +542,8 @@ int draw_rounded_box(const struct scale *pos_rel, const struct scale *dim_rel,
 		}
 	}
 
+	add_damage(&top_left, &t);
+
 	/* Step 1: Draw edges */
 	int32_t x_begin, x_end;
 	if (has_thickness) {
@@ -592,6 +693,7 @@ int draw_line(const struct scale *pos1, const struct scale *pos2,
 		return CBGFX_ERROR_BOUNDARY;
 	}
 
+	add_damage(&top_left, &t);
 	for (p.y = top_left.y; p.y < t.y; p.y++)
 		for (p.x = top_left.x; p.x < t.x; p.x++)
 			set_pixel(&p, color);
@@ -625,6 +727,8 @@ int clear_screen(const struct rgb_color *rgb)
 	const int bpp = fbinfo->bits_per_pixel;
 	const int bpl = fbinfo->bytes_per_line;
 
+	add_damage_screen();
+
 	/* If all significant bytes in color are equal, fastpath through memset.
 	 * We assume that for 32bpp the high byte gets ignored anyway. */
 	if ((((color >> 8) & 0xff) == (color & 0xff)) && (bpp == 16 ||
@@ -639,20 +743,6 @@ int clear_screen(const struct rgb_color *rgb)
 	return CBGFX_SUCCESS;
 }
 
-static int pal_to_rgb(uint8_t index, const struct bitmap_palette_element_v3 *pal,
-		      size_t palcount, struct rgb_color *out)
-{
-	if (index >= palcount) {
-		LOG("Color index %d exceeds palette boundary\n", index);
-		return CBGFX_ERROR_BITMAP_DATA;
-	}
-
-	out->red = pal[index].red;
-	out->green = pal[index].green;
-	out->blue = pal[index].blue;
-	return CBGFX_SUCCESS;
-}
-
 /*
  * We're using the Lanczos resampling algorithm to rescale images to a new size.
  * Since output size is often not cleanly divisible by input size, an output
@@ -736,6 +826,115 @@ static fpmath_t lanczos_weight(fpmath_t in, int off)
 	return fpdiv(fpmul(tmp, fpsin1(x2a)), x_times_pi);
 }
 
+/*
+ * Integer weights are stored with this many fractional bits. Horizontally
+ * filtered rows are kept with HROW_SHIFT fractional bits so that the vertical
+ * pass (color * 2^HROW_SHIFT * 2^WEIGHT_SHIFT summed over SSZ taps) still fits
+ * comfortably into an int32_t.
+ */
+#define WEIGHT_SHIFT	12
+#define HROW_SHIFT	6
+
+/*
+ * Precalculated filter taps for one output row or column: |start| is the input
+ * pixel corresponding to sample S0 and |weight| holds the integer weights for
+ * the SSZ input pixels around it. The weights are normalized to sum up to
+ * exactly 1 << WEIGHT_SHIFT, so flat areas come out without rounding errors.
+ */
+struct lanczos_taps {
+	int32_t start;
+	int32_t weight[SSZ];
+};
+
+static void calculate_taps(struct lanczos_taps *taps, int32_t out_size,
+			   int32_t in_size)
+{
+	int32_t o, i, sum;
+
+	for (o = 0; o < out_size; o++) {
+		fpmath_t ifp = fpfrac(o * in_size, out_size);
+
+		taps[o].start = fpfloor(ifp);
+		sum = 0;
+		for (i = 0; i < SSZ; i++) {
+			taps[o].weight[i] = fpround(fpmuli(lanczos_weight(ifp, i),
+							   1 << WEIGHT_SHIFT));
+			sum += taps[o].weight[i];
+		}
+		taps[o].weight[S0] += (1 << WEIGHT_SHIFT) - sum;
+	}
+}
+
+/* Horizontally filtered input row, one entry per output column. */
+struct hrow_pixel {
+	int32_t red;
+	int32_t green;
+	int32_t blue;
+};
+
+static int filter_row(struct hrow_pixel *out, const uint8_t *row,
+		      const struct lanczos_taps *taps, int32_t out_width,
+		      int32_t in_width, const struct bitmap_palette_element_v3 *pal,
+		      size_t palcount)
+{
+	const int32_t round = (1 << (WEIGHT_SHIFT - HROW_SHIFT)) >> 1;
+	int32_t ox, i;
+
+	for (ox = 0; ox < out_width; ox++) {
+		int32_t red = 0, green = 0, blue = 0;
+
+		for (i = 0; i < SSZ; i++) {
+			/* Clamp to the image edges. */
+			int32_t ix = MAX(0, MIN(in_width - 1,
+						taps[ox].start + i - S0));
+			uint8_t index = row[ix];
+
+			if (index >= palcount) {
+				LOG("Color index %d exceeds palette boundary\n",
+				    index);
+				return CBGFX_ERROR_BITMAP_DATA;
+			}
+			red += taps[ox].weight[i] * pal[index].red;
+			green += taps[ox].weight[i] * pal[index].green;
+			blue += taps[ox].weight[i] * pal[index].blue;
+		}
+		out[ox].red = (red + round) >> (WEIGHT_SHIFT - HROW_SHIFT);
+		out[ox].green = (green + round) >> (WEIGHT_SHIFT - HROW_SHIFT);
+		out[ox].blue = (blue + round) >> (WEIGHT_SHIFT - HROW_SHIFT);
+	}
+
+	return CBGFX_SUCCESS;
+}
+
+static inline uint8_t clamp_color(int32_t c)
+{
+	const int32_t shift = WEIGHT_SHIFT + HROW_SHIFT;
+
+	return MAX(0, MIN(UINT8_MAX, (c + (1 << (shift - 1))) >> shift));
+}
+
+/*
+ * Write a horizontal run of pixels starting at |start|. With a normally
+ * oriented 32bpp framebuffer this is a single memcpy(), otherwise it falls
+ * back to set_pixel().
+ */
+static void set_pixel_span(const struct vector *start, const uint32_t *colors,
+			   int32_t count)
+{
+	struct vector p = *start;
+	int32_t i;
+
+	if (fbinfo->orientation == CB_FB_ORIENTATION_NORMAL &&
+	    fbinfo->bits_per_pixel == 32) {
+		memcpy(FB + p.y * fbinfo->bytes_per_line + p.x * 4, colors,
+		       count * sizeof(*colors));
+		return;
+	}
+
+	for (i = 0; i < count; i++, p.x++)
+		set_pixel(&p, colors[i]);
+}
+
 static int draw_bitmap_v3(const struct vector *top_left,
 			  const struct vector *dim,
 			  const struct vector *dim_org,
@@ -744,11 +943,12 @@ static int draw_bitmap_v3(const struct vector *top_left,
 			  const uint8_t *pixel_array, uint8_t invert)
 {
 	const int bpp = header->bits_per_pixel;
+	const size_t palcount = header->colors_used;
 	int32_t dir;
 	struct vector p;
 	int32_t ox, oy;		/* output (resampled) pixel coordinates */
-	int32_t ix, iy;		/* input (source image) pixel coordinates */
-	int sx, sy;	/* index into |sample| (not ringbuffer adjusted) */
+	int sy;			/* index into the Y taps */
+	int rv = CBGFX_SUCCESS;
 
 	if (header->compression) {
 		LOG("Compressed bitmaps are not supported\n");
@@ -781,200 +981,129 @@ static int draw_bitmap_v3(const struct vector *top_left,
 		dir = -1;
 	}
 
-	/* Don't waste time resampling when the scale is 1:1. */
+	/* One output line is assembled here and then written out at once. */
+	uint32_t *span = malloc(sizeof(*span) * dim->width);
+	if (!span)
+		return CBGFX_ERROR_UNKNOWN;
+
+	struct vector bottom_right;
+	add_vectors(&bottom_right, top_left, dim);
+	add_damage(top_left, &bottom_right);
+
+	/*
+	 * Don't waste time resampling when the scale is 1:1. Every palette
+	 * entry is converted to a framebuffer color only once.
+	 */
 	if (dim_org->width == dim->width && dim_org->height == dim->height) {
-		for (oy = 0; oy < dim->height; oy++, p.y += dir) {
-			p.x = top_left->x;
-			for (ox = 0; ox < dim->width; ox++, p.x++) {
-				struct rgb_color rgb;
-				if (pal_to_rgb(pixel_array[oy * y_stride + ox],
-					       pal, header->colors_used, &rgb))
-					return CBGFX_ERROR_BITMAP_DATA;
-				set_pixel(&p, calculate_color(&rgb, invert));
-			}
+		uint32_t colors[256];
+		size_t i;
+
+		for (i = 0; i < MIN(palcount, ARRAY_SIZE(colors)); i++) {
+			const struct rgb_color rgb = {
+				.red = pal[i].red,
+				.green = pal[i].green,
+				.blue = pal[i].blue,
+			};
+			colors[i] = calculate_color(&rgb, invert);
 		}
-		return CBGFX_SUCCESS;
-	}
 
-	/* Precalculate the X-weights for every possible ox so that we only have
-	   to multiply weights together in the end. */
-	fpmath_t (*weight_x)[SSZ] = malloc(sizeof(fpmath_t) * SSZ * dim->width);
-	if (!weight_x)
-		return CBGFX_ERROR_UNKNOWN;
-	for (ox = 0; ox < dim->width; ox++) {
-		for (sx = 0; sx < SSZ; sx++) {
-			fpmath_t ixfp = fpfrac(ox * dim_org->width, dim->width);
-			weight_x[ox][sx] = lanczos_weight(ixfp, sx);
+		for (oy = 0; oy < dim->height; oy++, p.y += dir) {
+			const uint8_t *row = &pixel_array[oy * y_stride];
+
+			for (ox = 0; ox < dim->width; ox++) {
+				if (row[ox] >= palcount) {
+					LOG("Color index %d exceeds palette boundary\n",
+					    row[ox]);
+					rv = CBGFX_ERROR_BITMAP_DATA;
+					goto out;
+				}
+				span[ox] = colors[row[ox]];
+			}
+			p.x = top_left->x;
+			set_pixel_span(&p, span, dim->width);
 		}
+		goto out;
 	}
 
 	/*
-	 * For every sy in the sample array, we directly cache a pointer into
-	 * the .BMP pixel array for the start of the corresponding line. On the
-	 * edges of the image (where we don't have any real pixels to fill all
-	 * lines in the sample array), we just reuse the last valid lines inside
-	 * the image for all lines that would lie outside.
+	 * The Lanczos kernel is separable, so we filter each input line
+	 * horizontally once (for all output columns), and then combine SSZ of
+	 * those filtered lines vertically for every output line. Filtered lines
+	 * are cached in a ring buffer indexed by input line, so when upscaling
+	 * every input line is only filtered once, and when downscaling only the
+	 * lines that actually contribute to an output line are filtered.
+	 *
+	 * All weights only depend on the output coordinate, so calculate them
+	 * for every output column and line upfront.
 	 */
-	const uint8_t *ypix[SSZ];
-	for (sy = 0; sy < SSZ; sy++) {
-		if (sy <= S0)
-			ypix[sy] = pixel_array;
-		else if (sy - S0 >= dim_org->height)
-			ypix[sy] = ypix[sy - 1];
-		else
-			ypix[sy] = &pixel_array[y_stride * (sy - S0)];
+	struct lanczos_taps *taps_x = malloc(sizeof(*taps_x) *
+					     (dim->width + dim->height));
+	struct hrow_pixel *hrows = malloc(sizeof(*hrows) * SSZ * dim->width);
+	struct lanczos_taps *taps_y = taps_x + dim->width;
+	int32_t hrow_line[SSZ];
+
+	if (!taps_x || !hrows) {
+		rv = CBGFX_ERROR_UNKNOWN;
+		goto out_resample;
 	}
+	calculate_taps(taps_x, dim->width, dim_org->width);
+	calculate_taps(taps_y, dim->height, dim_org->height);
+	for (sy = 0; sy < SSZ; sy++)
+		hrow_line[sy] = -1;
 
-	/* iy and ix track the input pixel corresponding to sample[S0][S0]. */
-	iy = 0;
 	for (oy = 0; oy < dim->height; oy++, p.y += dir) {
-		struct rgb_color sample[SSZ][SSZ];
+		const struct hrow_pixel *line[SSZ];
 
-		/* Like with X weights, we also cache all Y weights. */
-		fpmath_t iyfp = fpfrac(oy * dim_org->height, dim->height);
-		fpmath_t weight_y[SSZ];
-		for (sy = 0; sy < SSZ; sy++)
-			weight_y[sy] = lanczos_weight(iyfp, sy);
+		/* Make sure all input lines we need are filtered. */
+		for (sy = 0; sy < SSZ; sy++) {
+			int32_t iy = MAX(0, MIN(dim_org->height - 1,
+						taps_y[oy].start + sy - S0));
+			int slot = iy % SSZ;
 
-		/*
-		 * If we have a new input pixel line between the last oy and
-		 * this one, we have to adjust iy forward. When upscaling, this
-		 * is not always the case for each new output line. When
-		 * downscaling, we may even cross more than one line per output
-		 * pixel.
-		 */
-		while (fpfloor(iyfp) > iy) {
-			iy++;
-
-			/* Shift ypix array up to center around next iy line. */
-			for (sy = 0; sy < SSZ - 1; sy++)
-				ypix[sy] = ypix[sy + 1];
-
-			/* Calculate the last ypix that is being shifted in,
-			   but beware of reaching the end of the input image. */
-			if (iy + LNCZ_A < dim_org->height)
-				ypix[SSZ - 1] = &pixel_array[y_stride *
-							     (iy + LNCZ_A)];
+			line[sy] = &hrows[slot * dim->width];
+			if (hrow_line[slot] == iy)
+				continue;
+			rv = filter_row(&hrows[slot * dim->width],
+					&pixel_array[iy * y_stride], taps_x,
+					dim->width, dim_org->width, pal,
+					palcount);
+			if (rv)
+				goto out_resample;
+			hrow_line[slot] = iy;
 		}
 
-		/*
-		 * Initialize the sample array for this line, and also
-		 * the equals counter, which counts how many of the latest
-		 * pixels were exactly equal.
-		 */
-		int equals = 0;
-		uint8_t last_equal = ypix[0][0];
-		for (sx = 0; sx < SSZ; sx++) {
-			for (sy = 0; sy < SSZ; sy++) {
-				if (sx - S0 >= dim_org->width) {
-					sample[sx][sy] = sample[sx - 1][sy];
-					equals++;
-					continue;
-				}
-				/*
-				 * For pixels to the left of S0 there are no
-				 * corresponding input pixels so just use
-				 * ypix[sy][0].
-				 */
-				uint8_t i = ypix[sy][MAX(0, sx - S0)];
-				if (pal_to_rgb(i, pal, header->colors_used,
-					       &sample[sx][sy]))
-					goto bitmap_error;
-				if (i == last_equal) {
-					equals++;
-				} else {
-					last_equal = i;
-					equals = 1;
-				}
-			}
-		}
+		const int32_t *w = taps_y[oy].weight;
+		for (ox = 0; ox < dim->width; ox++) {
+			int32_t red = 0, green = 0, blue = 0;
 
-		ix = 0;
-		p.x = top_left->x;
-		for (ox = 0; ox < dim->width; ox++, p.x++) {
-			/* Adjust ix forward, same as iy above. */
-			fpmath_t ixfp = fpfrac(ox * dim_org->width, dim->width);
-			while (fpfloor(ixfp) > ix) {
-				ix++;
-
-				/*
-				 * We want to reuse the sample columns we
-				 * already have, but we don't want to copy them
-				 * all around for every new column either.
-				 * Instead, treat the X dimension of the sample
-				 * array like a ring buffer indexed by ix. rx is
-				 * the ringbuffer-adjusted offset of the new
-				 * column in sample (the rightmost one) we're
-				 * trying to fill.
-				 */
-				int rx = (SSZ - 1 + ix) % SSZ;
-				for (sy = 0; sy < SSZ; sy++) {
-					if (ix + LNCZ_A >= dim_org->width) {
-						sample[rx][sy] = sample[(SSZ - 2
-							+ ix) % SSZ][sy];
-						equals++;
-						continue;
-					}
-					uint8_t i = ypix[sy][ix + LNCZ_A];
-					if (i == last_equal) {
-						if (equals++ >= (SSZ * SSZ))
-							continue;
-					} else {
-						last_equal = i;
-						equals = 1;
-					}
-					if (pal_to_rgb(i, pal,
-						       header->colors_used,
-						       &sample[rx][sy]))
-						goto bitmap_error;
-				}
-			}
-
-			/* If all pixels in sample are equal, fast path. */
-			if (equals >= (SSZ * SSZ)) {
-				set_pixel(&p, calculate_color(&sample[0][0],
-							      invert));
-				continue;
-			}
-
-			fpmath_t red = fp(0);
-			fpmath_t green = fp(0);
-			fpmath_t blue = fp(0);
 			for (sy = 0; sy < SSZ; sy++) {
-				for (sx = 0; sx < SSZ; sx++) {
-					int rx = (sx + ix) % SSZ;
-					fpmath_t weight = fpmul(weight_x[ox][sx],
-								weight_y[sy]);
-					red = fpadd(red, fpmuli(weight,
-						sample[rx][sy].red));
-					green = fpadd(green, fpmuli(weight,
-						sample[rx][sy].green));
-					blue = fpadd(blue, fpmuli(weight,
-						sample[rx][sy].blue));
-				}
+				red += w[sy] * line[sy][ox].red;
+				green += w[sy] * line[sy][ox].green;
+				blue += w[sy] * line[sy][ox].blue;
 			}
 
 			/*
-			 * Weights *should* sum up to 1.0 (making this not
-			 * necessary) but just to hedge against rounding errors
-			 * we should clamp color values to their legal limits.
+			 * Weights sum up to 1.0, but negative lobes can still
+			 * overshoot, so clamp color values to their legal
+			 * limits.
 			 */
-			struct rgb_color rgb = {
-				.red = MAX(0, MIN(UINT8_MAX, fpround(red))),
-				.green = MAX(0, MIN(UINT8_MAX, fpround(green))),
-				.blue = MAX(0, MIN(UINT8_MAX, fpround(blue))),
+			const struct rgb_color rgb = {
+				.red = clamp_color(red),
+				.green = clamp_color(green),
+				.blue = clamp_color(blue),
 			};
-
-			set_pixel(&p, calculate_color(&rgb, invert));
+			span[ox] = calculate_color(&rgb, invert);
 		}
+		p.x = top_left->x;
+		set_pixel_span(&p, span, dim->width);
 	}
 
-	free(weight_x);
-	return CBGFX_SUCCESS;
-
-bitmap_error:
-	free(weight_x);
-	return CBGFX_ERROR_BITMAP_DATA;
+out_resample:
+	free(hrows);
+	free(taps_x);
+out:
+	free(span);
+	return rv;
 }
 
 static int get_bitmap_file_header(const void *bitmap, size_t size,
@@ -1276,15 +1405,66 @@ int enable_graphics_buffer(void)
 		return CBGFX_ERROR_GRAPHICS_BUFFER;
 	}
 
+	/* The first flush has to push the whole buffer. */
+	damage_count = 0;
+	add_damage_screen();
+
 	return CBGFX_SUCCESS;
 }
 
+/* Copy one damaged region, given in canvas orientation, to the framebuffer. */
+static void flush_rect(const struct rect *r)
+{
+	const int bpp = fbinfo->bits_per_pixel;
+	const int bpl = fbinfo->bytes_per_line;
+	int32_t x, y, width, height;
+
+	switch (fbinfo->orientation) {
+	case CB_FB_ORIENTATION_NORMAL:
+	default:
+		x = r->offset.x;
+		y = r->offset.y;
+		width = r->size.width;
+		height = r->size.height;
+		break;
+	case CB_FB_ORIENTATION_BOTTOM_UP:
+		x = screen.size.width - r->offset.x - r->size.width;
+		y = screen.size.height - r->offset.y - r->size.height;
+		width = r->size.width;
+		height = r->size.height;
+		break;
+	case CB_FB_ORIENTATION_LEFT_UP:
+		x = r->offset.y;
+		y = screen.size.width - r->offset.x - r->size.width;
+		width = r->size.height;
+		height = r->size.width;
+		break;
+	case CB_FB_ORIENTATION_RIGHT_UP:
+		x = screen.size.height - r->offset.y - r->size.height;
+		y = r->offset.x;
+		width = r->size.height;
+		height = r->size.width;
+		break;
+	}
+
+	const size_t start = x * bpp / 8;
+	const size_t len = ROUNDUP(width * bpp, 8) / 8;
+	for (; height > 0; height--, y++)
+		memcpy(REAL_FB + y * bpl + start, gfx_buffer + y * bpl + start,
+		       len);
+}
+
 int flush_graphics_buffer(void)
 {
+	int i;
+
 	if (!gfx_buffer)
 		return CBGFX_ERROR_GRAPHICS_BUFFER;
 
-	memcpy(REAL_FB, gfx_buffer, fbinfo->y_resolution * fbinfo->bytes_per_line);
+	for (i = 0; i < damage_count; i++)
+		flush_rect(&damage[i]);
+	damage_count = 0;
+
 	return CBGFX_SUCCESS;
 }
 
@@ -1292,4 +1472,5 @@ void disable_graphics_buffer(void)
 {
 	free(gfx_buffer);
 	gfx_buffer = NULL;
+	damage_count = 0;
 }
@@ -268,6 +268,7 @@ struct cbfs_handle {
 	u32 attribute_offset;		/* relative offset of attributes */
 	u32 content_offset;		/* relative offset of contents */
 	u32 content_size;		/* length of file contents in bytes */
+	const void *mdata;		/* cached file header, or NULL */
 };
 
 /* Returns handle to CBFS file, or NULL on error. Does not yet map contents.
@@ -252,6 +252,22 @@ struct cb_cbmem_tab {
 	uint64_t cbmem_tab;
 };
 
+/*
+ * There can be more than one of these records as there is one per cbmem entry.
+ */
+struct cb_cbmem_entry {
+	uint32_t tag;
+	uint32_t size;
+
+	uint64_t address;
+	uint32_t entry_size;
+	uint32_t id;
+};
+
+/* CBMEM IDs of the CBFS metadata caches coreboot leaves behind. */
+#define CBMEM_ID_CBFS_RO_MCACHE	0x524d5346
+#define CBMEM_ID_CBFS_RW_MCACHE	0x574d5346
+
 struct cb_x86_rom_mtrr {
 	uint32_t tag;
 	uint32_t size;
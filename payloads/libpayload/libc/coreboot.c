@@ -246,6 +246,25 @@ static void cb_parse_fmap_cache(void *ptr, struct sysinfo_t *info)
 	info->fmap_cache = get_cbmem_addr(ptr);
 }
 
+static void cb_parse_cbmem_entry(void *ptr, struct sysinfo_t *info)
+{
+	const struct cb_cbmem_entry *cbmem_entry = ptr;
+
+	if (cbmem_entry->size != sizeof(*cbmem_entry))
+		return;
+
+	switch (cbmem_entry->id) {
+	case CBMEM_ID_CBFS_RO_MCACHE:
+		info->cbfs_ro_mcache_offset = cbmem_entry->address;
+		info->cbfs_ro_mcache_size = cbmem_entry->entry_size;
+		break;
+	case CBMEM_ID_CBFS_RW_MCACHE:
+		info->cbfs_rw_mcache_offset = cbmem_entry->address;
+		info->cbfs_rw_mcache_size = cbmem_entry->entry_size;
+		break;
+	}
+}
+
 #if CONFIG(LP_TIMER_RDTSC)
 static void cb_parse_tsc_info(void *ptr, struct sysinfo_t *info)
 {
@@ -420,6 +439,9 @@ int cb_parse_header(void *addr, int len, struct sysinfo_t *info)
 		case CB_TAG_FMAP:
 			cb_parse_fmap_cache(ptr, info);
 			break;
+		case CB_TAG_CBMEM_ENTRY:
+			cb_parse_cbmem_entry(ptr, info);
+			break;
 		default:
 			cb_parse_arch_specific(rec, info);
 			break;
@@ -135,6 +135,121 @@ static int get_cbfs_range(uint32_t *offset, uint32_t *cbfs_end,
 	return 0;
 }
 
+/*
+ * coreboot leaves a copy of its CBFS metadata cache (mcache) in CBMEM. It is a
+ * sequence of raw CBFS file headers (including name and attributes, values in
+ * big-endian), each aligned to MCACHE_ALIGNMENT. The 'LARCHIVE' magic of each
+ * header is replaced with MCACHE_MAGIC_FILE and the offset of the file relative
+ * to the start of the CBFS. The cache is terminated by a 4-byte entry that only
+ * holds MCACHE_MAGIC_END, or MCACHE_MAGIC_FULL if coreboot ran out of space.
+ * See commonlib/bsd/cbfs_mcache.c in coreboot.
+ */
+#define MCACHE_MAGIC_FILE	0x454c4946	/* 'FILE' */
+#define MCACHE_MAGIC_FULL	0x4c4c5546	/* 'FULL' */
+#define MCACHE_MAGIC_END	0x444e4524	/* '$END' */
+#define MCACHE_ALIGNMENT	sizeof(uint32_t)
+
+union mcache_entry {
+	struct cbfs_file file;
+	struct {	/* These fields exactly overlap file.magic */
+		uint32_t magic;
+		uint32_t offset;
+	};
+};
+
+/* Returns the mcache describing the default CBFS, or NULL if there is none. */
+static const void *cbfs_default_mcache(size_t *size)
+{
+	static int initialized;
+	static const void *mcache;
+	static size_t mcache_size;
+	uint32_t ro_offset;
+	uintptr_t addr = 0;
+
+	if (initialized)
+		goto out;
+	initialized = 1;
+
+	/* mcache entries are relative to the CBFS coreboot booted from. */
+	if (!lib_sysinfo.cbfs_offset || !lib_sysinfo.cbfs_size)
+		goto out;
+	if (fmap_region_by_name(lib_sysinfo.fmap_offset, "COREBOOT",
+				&ro_offset, NULL))
+		goto out;
+
+	/* coreboot only creates the RW mcache if vboot booted from RW CBFS. */
+	if (lib_sysinfo.cbfs_offset == ro_offset) {
+		addr = lib_sysinfo.cbfs_ro_mcache_offset;
+		mcache_size = lib_sysinfo.cbfs_ro_mcache_size;
+	} else {
+		addr = lib_sysinfo.cbfs_rw_mcache_offset;
+		mcache_size = lib_sysinfo.cbfs_rw_mcache_size;
+	}
+
+	if (addr && mcache_size)
+		mcache = phys_to_virt(addr);
+	else
+		mcache_size = 0;
+	DEBUG("CBFS mcache at %p (%zu bytes).\n", mcache, mcache_size);
+out:
+	*size = mcache_size;
+	return mcache;
+}
+
+/* Look up |name| in the mcache and fill in |handle| if it is found. Returns 0
+ * on success, -1 if the file does not exist and 1 if the mcache can't tell
+ * (because it is missing, incomplete or corrupted). */
+static int cbfs_mcache_lookup(const char *name, struct cbfs_handle *handle)
+{
+	const size_t namesize = strlen(name) + 1;
+	size_t mcache_size;
+	const void *mcache = cbfs_default_mcache(&mcache_size);
+	const void *end = mcache + mcache_size;
+	const void *current = mcache;
+
+	if (!mcache)
+		return 1;
+
+	while (current + sizeof(uint32_t) <= end) {
+		const union mcache_entry *entry = current;
+		uint32_t data_offset;
+
+		if (entry->magic == MCACHE_MAGIC_END)
+			return -1;
+		/* On MCACHE_MAGIC_FULL the file may still be on the media. */
+		if (entry->magic != MCACHE_MAGIC_FILE ||
+		    current + sizeof(entry->file) > end)
+			break;
+
+		data_offset = ntohl(entry->file.offset);
+		if (data_offset < sizeof(entry->file) ||
+		    current + data_offset > end) {
+			ERROR("ERROR: corrupted CBFS mcache entry at %p.\n",
+			      current);
+			break;
+		}
+
+		if (namesize <= data_offset - sizeof(entry->file) &&
+		    memcmp(name, entry->file.filename, namesize) == 0) {
+			DEBUG("Found '%s' in mcache (offset=0x%x).\n", name,
+			      entry->offset);
+			handle->type = ntohl(entry->file.type);
+			handle->media_offset = lib_sysinfo.cbfs_offset +
+					       entry->offset;
+			handle->content_offset = data_offset;
+			handle->content_size = ntohl(entry->file.len);
+			handle->attribute_offset =
+				ntohl(entry->file.attributes_offset);
+			handle->mdata = entry;
+			return 0;
+		}
+
+		current += ALIGN_UP(data_offset, MCACHE_ALIGNMENT);
+	}
+
+	return 1;
+}
+
 /* public API starts here*/
 struct cbfs_handle *cbfs_get_handle(struct cbfs_media *media, const char *name)
 {
@@ -145,6 +260,7 @@ struct cbfs_handle *cbfs_get_handle(struct cbfs_media *media, const char *name)
 
 	if (!handle)
 		return NULL;
+	handle->mdata = NULL;
 
 	if (get_cbfs_range(&offset, &cbfs_end, media)) {
 		ERROR("Failed to find cbfs range\n");
@@ -159,6 +275,16 @@ struct cbfs_handle *cbfs_get_handle(struct cbfs_media *media, const char *name)
 			free(handle);
 			return NULL;
 		}
+
+		/* Avoid walking the headers on the media if possible. */
+		switch (cbfs_mcache_lookup(name, handle)) {
+		case 0:
+			return handle;
+		case -1:
+			LOG("WARNING: '%s' not found.\n", name);
+			free(handle);
+			return NULL;
+		}
 	} else {
 		memcpy(&handle->media, media, sizeof(*media));
 	}
@@ -306,6 +432,27 @@ void *cbfs_get_attr(struct cbfs_handle *handle, uint32_t tag)
 	if (handle->attribute_offset <= sizeof(struct cbfs_file))
 		return NULL;
 
+	/* The cached header includes the attributes. */
+	if (handle->mdata) {
+		const uint8_t *mdata = handle->mdata;
+
+		offset = handle->attribute_offset;
+		end = handle->content_offset;
+		while (offset + sizeof(attr) <= end) {
+			memcpy(&attr, mdata + offset, sizeof(attr));
+			if (ntohl(attr.len) < sizeof(attr) ||
+			    offset + ntohl(attr.len) > end) {
+				ERROR("ERROR: corrupted CBFS attribute "
+				      "at 0x%x.\n", offset);
+				return NULL;
+			}
+			if (ntohl(attr.tag) == tag)
+				return (void *)(mdata + offset);
+			offset += ntohl(attr.len);
+		}
+		return NULL;
+	}
+
 	m->open(m);
 	while (offset + sizeof(attr) <= end) {
 		if (m->read(m, &attr, offset, sizeof(attr)) != sizeof(attr)) {
@@ -0,0 +1,186 @@
+/*
+ * Host-side benchmark for the cbgfx bitmap renderer.
+ *
+ * This links drivers/video/graphics.c against the host C library and renders
+ * a synthetic 8bpp palette bitmap into a malloc()ed 32bpp "framebuffer" at a
+ * few typical scale factors, reporting frames per second for each case.
+ *
+ * Usage: ./cbgfx-bench [seconds per case]
+ */
+
+/* libpayload headers */
+#include <libpayload.h>
+#include <sysinfo.h>
+#include "../drivers/video/bitmap.h"
+
+#define FB_WIDTH	1920
+#define FB_HEIGHT	1080
+#define BMP_WIDTH	400
+#define BMP_HEIGHT	300
+#define BMP_COLORS	256
+
+struct sysinfo_t lib_sysinfo;
+unsigned long virtual_offset = 0;
+
+static uint64_t now_us(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void *make_bitmap(size_t *size)
+{
+	const size_t stride = ALIGN_UP(BMP_WIDTH, 4);
+	const size_t pal_size = BMP_COLORS *
+				sizeof(struct bitmap_palette_element_v3);
+	const size_t offset = sizeof(struct bitmap_file_header) +
+			      sizeof(struct bitmap_header_v3) + pal_size;
+	const size_t total = offset + stride * BMP_HEIGHT;
+	uint8_t *bmp = calloc(1, total);
+	struct bitmap_file_header *fh = (void *)bmp;
+	struct bitmap_header_v3 *h = (void *)(fh + 1);
+	struct bitmap_palette_element_v3 *pal = (void *)(h + 1);
+	uint8_t *pixels = bmp + offset;
+	int x, y;
+
+	if (!bmp)
+		return NULL;
+
+	fh->signature[0] = 'B';
+	fh->signature[1] = 'M';
+	fh->file_size = total;
+	fh->bitmap_offset = offset;
+	h->header_size = sizeof(*h);
+	h->width = BMP_WIDTH;
+	h->height = -BMP_HEIGHT;
+	h->planes = 1;
+	h->bits_per_pixel = 8;
+	h->size = stride * BMP_HEIGHT;
+	h->colors_used = BMP_COLORS;
+
+	for (x = 0; x < BMP_COLORS; x++) {
+		pal[x].red = x;
+		pal[x].green = 255 - x;
+		pal[x].blue = (x * 7) & 0xff;
+	}
+
+	/* Flat areas with gradients and edges, like a typical UI asset. */
+	for (y = 0; y < BMP_HEIGHT; y++)
+		for (x = 0; x < BMP_WIDTH; x++)
+			pixels[y * stride + x] = ((x / 40 + y / 30) & 1) ?
+				(x + y) & 0xff : 0x20;
+
+	*size = total;
+	return bmp;
+}
+
+static void bench(const char *name, const void *bmp, size_t size,
+		  const struct fraction *width, unsigned int seconds)
+{
+	const struct scale pos = {
+		.x = { .n = 1, .d = 2 },
+		.y = { .n = 1, .d = 2 },
+	};
+	struct scale dim = {
+		.y = { .n = 0, .d = 1 },
+	};
+	const uint32_t flags = PIVOT_H_CENTER | PIVOT_V_CENTER;
+	const struct vector top_left = { .x = 0, .y = 0 };
+	uint64_t start, elapsed;
+	unsigned int frames = 0;
+	int rv;
+
+	if (width)
+		dim.x = *width;
+
+	start = now_us();
+	do {
+		if (width)
+			rv = draw_bitmap(bmp, size, &pos, &dim, flags);
+		else
+			rv = draw_bitmap_direct(bmp, size, &top_left);
+		if (rv) {
+			printf("%-24s failed: %d\n", name, rv);
+			return;
+		}
+		frames++;
+		elapsed = now_us() - start;
+	} while (elapsed < seconds * 1000000ULL);
+
+	printf("%-24s %8u frames %8llu.%02llu fps\n", name, frames,
+	       frames * 1000000ULL / elapsed,
+	       frames * 100000000ULL / elapsed % 100);
+}
+
+/* Redraw a menu-item-sized box into the graphics buffer and flush it. */
+static void bench_flush(unsigned int seconds)
+{
+	const struct rect box = {
+		.offset = { .x = 10, .y = 40 },
+		.size = { .width = 80, .height = 5 },
+	};
+	const struct rgb_color rgb = { .red = 0x20, .green = 0x40 };
+	uint64_t start, elapsed;
+	unsigned int frames = 0;
+
+	if (enable_graphics_buffer()) {
+		printf("%-24s failed\n", "buffered box + flush");
+		return;
+	}
+
+	start = now_us();
+	do {
+		draw_box(&box, &rgb);
+		flush_graphics_buffer();
+		frames++;
+		elapsed = now_us() - start;
+	} while (elapsed < seconds * 1000000ULL);
+
+	disable_graphics_buffer();
+
+	printf("%-24s %8u frames %8llu.%02llu fps\n", "buffered box + flush",
+	       frames, frames * 1000000ULL / elapsed,
+	       frames * 100000000ULL / elapsed % 100);
+}
+
+int main(int argc, char **argv)
+{
+	struct cb_framebuffer *fb = &lib_sysinfo.framebuffer;
+	const struct fraction downscale = { .n = 1, .d = 4 };
+	const struct fraction upscale = { .n = 3, .d = 4 };
+	unsigned int seconds = 2;
+	size_t size;
+	void *bmp;
+
+	if (argc > 1)
+		seconds = atol(argv[1]);
+
+	fb->physical_address = (uintptr_t)malloc(FB_WIDTH * FB_HEIGHT * 4);
+	fb->x_resolution = FB_WIDTH;
+	fb->y_resolution = FB_HEIGHT;
+	fb->bytes_per_line = FB_WIDTH * 4;
+	fb->bits_per_pixel = 32;
+	fb->red_mask_pos = 16;
+	fb->red_mask_size = 8;
+	fb->green_mask_pos = 8;
+	fb->green_mask_size = 8;
+	fb->blue_mask_pos = 0;
+	fb->blue_mask_size = 8;
+
+	bmp = make_bitmap(&size);
+	if (!fb->physical_address || !bmp) {
+		printf("out of memory\n");
+		return 1;
+	}
+
+	printf("cbgfx: %dx%d 8bpp bitmap on %dx%d 32bpp framebuffer\n",
+	       BMP_WIDTH, BMP_HEIGHT, FB_WIDTH, FB_HEIGHT);
+	bench("unscaled", bmp, size, NULL, seconds);
+	bench("downscaled (1/4 canvas)", bmp, size, &downscale, seconds);
+	bench("upscaled (3/4 canvas)", bmp, size, &upscale, seconds);
+	bench_flush(seconds);
+
+	return 0;
+}
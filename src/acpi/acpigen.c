@@ -407,6 +407,81 @@ void acpigen_write_processor(u8 cpuindex, u32 pblock_addr, u8 pblock_len)
 	acpigen_emit_byte(pblock_len);
 }
 
+/* Template that is being generated, see acpigen_write_processor_template() */
+static struct acpigen_cpu_template *cpu_template;
+
+void acpigen_write_processor_template(struct acpigen_cpu_template *tmpl,
+				      u8 cpuindex, u32 pblock_addr,
+				      u8 pblock_len)
+{
+	char pscope[16];
+
+	memset(tmpl, 0, sizeof(*tmpl));
+	tmpl->start = gencurrent;
+	cpu_template = tmpl;
+
+	acpigen_emit_ext_op(PROCESSOR_OP);
+	acpigen_write_len_f();
+
+	snprintf(pscope, sizeof(pscope),
+		 CONFIG_ACPI_CPU_STRING, (unsigned int) cpuindex);
+	tmpl->name_offset = gencurrent - tmpl->start;
+	acpigen_emit_namestring(pscope);
+	tmpl->name_size = gencurrent - tmpl->start - tmpl->name_offset;
+	tmpl->id_offset = gencurrent - tmpl->start;
+	acpigen_emit_byte(cpuindex);
+	acpigen_emit_dword(pblock_addr);
+	acpigen_emit_byte(pblock_len);
+}
+
+void acpigen_write_processor_template_end(void)
+{
+	acpigen_pop_len();
+	cpu_template = NULL;
+}
+
+int acpigen_write_processor_copy(const struct acpigen_cpu_template *tmpl,
+				 u8 cpuindex, u32 psd_domain, u32 tsd_domain)
+{
+	const unsigned char *pkglen = (unsigned char *)tmpl->start + 2;
+	char *current = gencurrent;
+	char pscope[16];
+	char name[64];
+	size_t size;
+
+	if (!tmpl->start)
+		return -1;
+
+	/* Encode the new name on the side, it must fit in the old one's place */
+	snprintf(pscope, sizeof(pscope),
+		 CONFIG_ACPI_CPU_STRING, (unsigned int) cpuindex);
+	gencurrent = name;
+	acpigen_emit_namestring(pscope);
+	size = gencurrent - name;
+	gencurrent = current;
+	if (size != tmpl->name_size)
+		return -1;
+
+	/* ExtOpPrefix, ProcessorOp and the PkgLength from acpigen_write_len_f() */
+	size = 2 + ((pkglen[0] & 0xf) | pkglen[1] << 4 | pkglen[2] << 12);
+
+	memcpy(current, tmpl->start, size);
+	memcpy(current + tmpl->name_offset, name, tmpl->name_size);
+	current[tmpl->id_offset] = cpuindex;
+
+	if (tmpl->psd_domain_offset) {
+		gencurrent = current + tmpl->psd_domain_offset;
+		acpigen_emit_dword(psd_domain);
+	}
+	if (tmpl->tsd_domain_offset) {
+		gencurrent = current + tmpl->tsd_domain_offset;
+		acpigen_emit_dword(tsd_domain);
+	}
+
+	gencurrent = current + size;
+	return 0;
+}
+
 void acpigen_write_processor_package(const char *const name,
 				     const unsigned int first_core,
 				     const unsigned int core_count)
@@ -986,6 +1061,9 @@ void acpigen_write_PSD_package(u32 domain, u32 numprocs, PSD_coord coordtype)
 	acpigen_write_package(5);
 	acpigen_write_byte(5);	// 5 values
 	acpigen_write_byte(0);	// revision 0
+	if (cpu_template)
+		cpu_template->psd_domain_offset =
+			gencurrent + 1 - cpu_template->start;
 	acpigen_write_dword(domain);
 	acpigen_write_dword(coordtype);
 	acpigen_write_dword(numprocs);
@@ -1069,6 +1147,9 @@ void acpigen_write_TSD_package(u32 domain, u32 numprocs, PSD_coord coordtype)
 	acpigen_write_package(5);
 	acpigen_write_byte(5);	// 5 values
 	acpigen_write_byte(0);	// revision 0
+	if (cpu_template)
+		cpu_template->tsd_domain_offset =
+			gencurrent + 1 - cpu_template->start;
 	acpigen_write_dword(domain);
 	acpigen_write_dword(coordtype);
 	acpigen_write_dword(numprocs);
@@ -0,0 +1,33 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef __ARCH_TABLE_CACHE_H
+#define __ARCH_TABLE_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if CONFIG(TABLE_CACHE)
+/*
+ * Copy the tables cached for |cbmem_id| to |start| if the hardware
+ * configuration is unchanged since they were generated. Returns the end of
+ * the restored tables or 0 if they have to be generated.
+ */
+unsigned long table_cache_restore(uint32_t cbmem_id, unsigned long start,
+				  size_t max_size);
+
+/* Remember the tables generated for |cbmem_id| for the next boot. */
+void table_cache_record(uint32_t cbmem_id, unsigned long start,
+			unsigned long end);
+#else
+static inline unsigned long table_cache_restore(uint32_t cbmem_id,
+						unsigned long start,
+						size_t max_size)
+{
+	return 0;
+}
+
+static inline void table_cache_record(uint32_t cbmem_id, unsigned long start,
+				      unsigned long end) {}
+#endif
+
+#endif
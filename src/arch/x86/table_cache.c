@@ -0,0 +1,392 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <acpi/acpi.h>
+#include <acpi/acpigen.h>
+#include <arch/table_cache.h>
+#include <bootstate.h>
+#include <cbmem.h>
+#include <commonlib/helpers.h>
+#include <console/console.h>
+#include <crc_byte.h>
+#include <device/device.h>
+#include <fmap.h>
+#include <fw_config.h>
+#include <ip_checksum.h>
+#include <memory_info.h>
+#include <region_file.h>
+#include <smbios.h>
+#include <string.h>
+#include <version.h>
+
+/*
+ * The ACPI and SMBIOS tables of the last boot are kept in a region file in
+ * the TABLE_CACHE FMAP region:
+ *
+ *    +-------------------------+
+ *    | struct table_cache_hdr  |
+ *    +-------------------------+
+ *    | struct table_cache_entry| x num_entries
+ *    +-------------------------+
+ *    | table data              | in entry order
+ *    +-------------------------+
+ *
+ * The tables contain absolute pointers, so they can only be reused if they
+ * land at the same address in CBMEM. Everything else they are generated from
+ * is summarized in the key: the build (which includes the static devicetree),
+ * the devices found at runtime and their resources, the DIMMs, fw_config, the
+ * VPD and the identification strings that go into SMBIOS.
+ *
+ * A table generator that allocates CBMEM can't be skipped, as the OS would
+ * find the pointers into that memory dangling. Kconfig rules out the known
+ * ones; the option ROM copies the default PCI ops make for display devices
+ * are checked at runtime and keep the tables from being cached.
+ */
+
+#define TABLE_CACHE_SIGNATURE	(('T'<<0)|('B'<<8)|('L'<<16)|('C'<<24))
+#define TABLE_CACHE_VERSION	1
+#define TABLE_CACHE_MAX_ENTRIES	4
+
+struct table_cache_hdr {
+	uint32_t signature;
+	uint32_t version;
+	uint32_t key;
+	uint32_t num_entries;
+	uint32_t data_size;	/* Entries and table data following the header */
+	uint16_t data_checksum;
+	uint16_t header_checksum;
+} __packed;
+
+struct table_cache_entry {
+	uint32_t cbmem_id;
+	uint32_t size;
+	uint64_t address;
+} __packed;
+
+static struct {
+	bool initialized;
+	uint32_t key;
+	/* Validated cache contents in the boot device, or NULL */
+	const struct table_cache_hdr *cached;
+	/* Tables of this boot */
+	struct table_cache_entry entries[TABLE_CACHE_MAX_ENTRIES];
+	size_t num_entries;
+	bool dirty;
+} tc;
+
+static uint32_t crc32_buffer(uint32_t crc, const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+
+	while (len--)
+		crc = crc32_byte(crc, *p++);
+
+	return crc;
+}
+
+static uint32_t crc32_string(uint32_t crc, const char *str)
+{
+	return crc32_buffer(crc, str, strlen(str) + 1);
+}
+
+static uint32_t table_cache_smbios_key(uint32_t crc)
+{
+	const char *const strings[] = {
+		smbios_system_manufacturer(),
+		smbios_system_product_name(),
+		smbios_system_serial_number(),
+		smbios_system_version(),
+		smbios_system_sku(),
+		smbios_mainboard_manufacturer(),
+		smbios_mainboard_product_name(),
+		smbios_mainboard_serial_number(),
+		smbios_mainboard_version(),
+		smbios_mainboard_bios_version(),
+		smbios_mainboard_asset_tag(),
+		smbios_mainboard_location_in_chassis(),
+		smbios_chassis_version(),
+		smbios_chassis_serial_number(),
+		smbios_processor_serial_number(),
+	};
+	u8 uuid[16] = { 0 };
+	size_t i;
+
+	/* Boards may read these from an EEPROM, the EC or VPD on every boot. */
+	for (i = 0; i < ARRAY_SIZE(strings); i++)
+		crc = crc32_string(crc, strings[i] ? strings[i] : "");
+
+	smbios_system_set_uuid(uuid);
+	return crc32_buffer(crc, uuid, sizeof(uuid));
+}
+
+static uint32_t table_cache_key(void)
+{
+	const struct device *dev;
+	const struct resource *res;
+	const struct memory_info *mem_info;
+	const struct cbmem_entry *vpd;
+	uint32_t crc = 0;
+
+	crc = crc32_string(crc, coreboot_version);
+	crc = crc32_string(crc, coreboot_extra_version);
+	crc = crc32_string(crc, coreboot_build);
+	crc = crc32_string(crc, coreboot_compile_time);
+
+	for (dev = all_devices; dev; dev = dev->next) {
+		const uint32_t ids[] = {
+			dev->vendor, dev->device, dev->class,
+			dev->subsystem_vendor, dev->subsystem_device,
+			dev->enabled,
+		};
+
+		/* The raw device_path may contain uninitialized bytes. */
+		crc = crc32_string(crc, dev_path(dev));
+		crc = crc32_buffer(crc, ids, sizeof(ids));
+
+		for (res = dev->resource_list; res; res = res->next) {
+			const uint64_t desc[] = {
+				res->base, res->size, res->flags, res->index,
+			};
+
+			crc = crc32_buffer(crc, desc, sizeof(desc));
+		}
+	}
+
+	mem_info = cbmem_find(CBMEM_ID_MEMINFO);
+	if (mem_info)
+		crc = crc32_buffer(crc, mem_info, sizeof(*mem_info));
+
+	if (CONFIG(FW_CONFIG)) {
+		const uint64_t fw_config = fw_config_get();
+
+		crc = crc32_buffer(crc, &fw_config, sizeof(fw_config));
+	}
+
+	/* Mainboards put VPD values into both ACPI and SMBIOS tables. */
+	vpd = cbmem_entry_find(CBMEM_ID_VPD);
+	if (vpd)
+		crc = crc32_buffer(crc, cbmem_entry_start(vpd),
+				   cbmem_entry_size(vpd));
+
+	if (CONFIG(GENERATE_SMBIOS_TABLES))
+		crc = table_cache_smbios_key(crc);
+
+	return crc;
+}
+
+static uint16_t table_cache_header_checksum(const struct table_cache_hdr *hdr)
+{
+	struct table_cache_hdr copy = *hdr;
+
+	copy.header_checksum = 0;
+	return compute_ip_checksum(&copy, sizeof(copy));
+}
+
+static const struct table_cache_hdr *table_cache_load(void)
+{
+	struct region_device rdev, data_rdev;
+	struct region_file cache_file;
+	const struct table_cache_hdr *hdr;
+	size_t size;
+
+	if (fmap_locate_area_as_rdev(CONFIG_TABLE_CACHE_FMAP_NAME, &rdev)) {
+		printk(BIOS_ERR, "TABLE_CACHE: Cannot find %s region\n",
+		       CONFIG_TABLE_CACHE_FMAP_NAME);
+		return NULL;
+	}
+
+	if (region_file_init(&cache_file, &rdev) < 0 ||
+	    region_file_data(&cache_file, &data_rdev) < 0)
+		return NULL;
+
+	size = region_device_sz(&data_rdev);
+	if (size < sizeof(*hdr))
+		return NULL;
+
+	/* Mapping is free on x86, so don't bother unmapping. */
+	hdr = rdev_mmap_full(&data_rdev);
+	if (!hdr)
+		return NULL;
+
+	if (hdr->signature != TABLE_CACHE_SIGNATURE ||
+	    hdr->version != TABLE_CACHE_VERSION ||
+	    hdr->header_checksum != table_cache_header_checksum(hdr) ||
+	    hdr->num_entries > TABLE_CACHE_MAX_ENTRIES ||
+	    hdr->data_size > size - sizeof(*hdr) ||
+	    hdr->data_size < hdr->num_entries * sizeof(struct table_cache_entry))
+		return NULL;
+
+	if (hdr->key != tc.key) {
+		printk(BIOS_DEBUG, "TABLE_CACHE: Configuration changed.\n");
+		return NULL;
+	}
+
+	if (hdr->data_checksum != compute_ip_checksum(hdr + 1, hdr->data_size)) {
+		printk(BIOS_ERR, "TABLE_CACHE: Data checksum mismatch\n");
+		return NULL;
+	}
+
+	return hdr;
+}
+
+static void table_cache_init(void)
+{
+	if (tc.initialized)
+		return;
+	tc.initialized = true;
+
+	tc.key = table_cache_key();
+	tc.cached = table_cache_load();
+}
+
+static void table_cache_add(uint32_t cbmem_id, unsigned long start,
+			    unsigned long end)
+{
+	struct table_cache_entry *entry;
+
+	if (tc.num_entries == ARRAY_SIZE(tc.entries)) {
+		printk(BIOS_ERR, "TABLE_CACHE: Too many tables.\n");
+		return;
+	}
+
+	entry = &tc.entries[tc.num_entries++];
+	entry->cbmem_id = cbmem_id;
+	entry->address = start;
+	entry->size = end - start;
+}
+
+/*
+ * Some inputs to the ACPI tables are not part of the key but change from
+ * boot to boot. They have to be refreshed even when the tables are reused.
+ */
+static void table_cache_patch_acpi(void)
+{
+	char scratch[256];
+	char *current = acpigen_get_current();
+
+	/* Refill the NVS areas. The AML declaring them is already there. */
+	acpigen_set_current(scratch);
+	if (CONFIG(ACPI_SOC_NVS))
+		acpi_fill_gnvs();
+	if (CONFIG(CHROMEOS_NVS))
+		acpi_fill_cnvs();
+	acpigen_set_current(current);
+}
+
+unsigned long table_cache_restore(uint32_t cbmem_id, unsigned long start,
+				  size_t max_size)
+{
+	const struct table_cache_entry *entry;
+	const uint8_t *data;
+	uint32_t i;
+
+	table_cache_init();
+
+	if (!tc.cached)
+		return 0;
+
+	entry = (const void *)(tc.cached + 1);
+	data = (const void *)(entry + tc.cached->num_entries);
+
+	for (i = 0; i < tc.cached->num_entries; i++, entry++) {
+		if (entry->cbmem_id == cbmem_id)
+			break;
+		data += entry->size;
+	}
+
+	if (i == tc.cached->num_entries)
+		return 0;
+
+	if (entry->address != start || entry->size > max_size ||
+	    data + entry->size > (const uint8_t *)(tc.cached + 1) +
+				 tc.cached->data_size) {
+		printk(BIOS_DEBUG, "TABLE_CACHE: Layout of %08x changed.\n",
+		       cbmem_id);
+		return 0;
+	}
+
+	memcpy((void *)start, data, entry->size);
+	if (cbmem_id == CBMEM_ID_ACPI)
+		table_cache_patch_acpi();
+
+	table_cache_add(cbmem_id, start, start + entry->size);
+	printk(BIOS_INFO, "TABLE_CACHE: Restored %08x (%u bytes).\n",
+	       cbmem_id, entry->size);
+
+	return start + entry->size;
+}
+
+/* CBMEM entries the generators left behind that a restored boot won't have */
+static bool table_cache_side_effects(void)
+{
+	uint32_t id;
+
+	for (id = CBMEM_ID_ROM0; id <= CBMEM_ID_ROM3; id++) {
+		if (cbmem_find(id))
+			return true;
+	}
+
+	return false;
+}
+
+void table_cache_record(uint32_t cbmem_id, unsigned long start,
+			unsigned long end)
+{
+	table_cache_init();
+	table_cache_add(cbmem_id, start, end);
+	tc.dirty = true;
+}
+
+static void table_cache_save(void *unused)
+{
+	struct update_region_file_entry blobs[2 + TABLE_CACHE_MAX_ENTRIES];
+	struct table_cache_hdr hdr = {
+		.signature = TABLE_CACHE_SIGNATURE,
+		.version = TABLE_CACHE_VERSION,
+		.key = tc.key,
+		.num_entries = tc.num_entries,
+	};
+	struct region_device rdev;
+	struct region_file cache_file;
+	unsigned long checksum;
+	size_t i;
+
+	if (!tc.dirty)
+		return;
+
+	if (table_cache_side_effects()) {
+		printk(BIOS_DEBUG,
+		       "TABLE_CACHE: Tables use other CBMEM entries, not caching.\n");
+		return;
+	}
+
+	blobs[0].data = &hdr;
+	blobs[0].size = sizeof(hdr);
+	blobs[1].data = tc.entries;
+	blobs[1].size = tc.num_entries * sizeof(tc.entries[0]);
+
+	hdr.data_size = blobs[1].size;
+	checksum = compute_ip_checksum(blobs[1].data, blobs[1].size);
+	for (i = 0; i < tc.num_entries; i++) {
+		blobs[2 + i].data = (const void *)(uintptr_t)tc.entries[i].address;
+		blobs[2 + i].size = tc.entries[i].size;
+		checksum = add_ip_checksums(hdr.data_size, checksum,
+			compute_ip_checksum(blobs[2 + i].data, blobs[2 + i].size));
+		hdr.data_size += blobs[2 + i].size;
+	}
+	hdr.data_checksum = checksum;
+	hdr.header_checksum = table_cache_header_checksum(&hdr);
+
+	if (fmap_locate_area_as_rdev_rw(CONFIG_TABLE_CACHE_FMAP_NAME, &rdev) ||
+	    region_file_init(&cache_file, &rdev) < 0 ||
+	    region_file_update_data_arr(&cache_file, blobs,
+					2 + tc.num_entries) < 0) {
+		printk(BIOS_ERR, "TABLE_CACHE: Failed to update %s.\n",
+		       CONFIG_TABLE_CACHE_FMAP_NAME);
+		return;
+	}
+
+	printk(BIOS_DEBUG, "TABLE_CACHE: Updated %s (%u bytes).\n",
+	       CONFIG_TABLE_CACHE_FMAP_NAME, hdr.data_size);
+}
+
+BOOT_STATE_INIT_ENTRY(BS_WRITE_TABLES, BS_ON_EXIT, table_cache_save, NULL);
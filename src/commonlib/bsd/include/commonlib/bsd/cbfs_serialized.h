@@ -133,6 +133,7 @@ enum cbfs_file_attr_tag {
 	CBFS_FILE_ATTR_TAG_IBB		= 0x32494242, /* BE: '2IBB' */
 	CBFS_FILE_ATTR_TAG_PADDING	= 0x47444150, /* BE: 'GNDP' */
 	CBFS_FILE_ATTR_TAG_STAGEHEADER	= 0x53746748, /* BE: 'StgH' */
+	CBFS_FILE_ATTR_TAG_MCU_INDEX	= 0x4d637549, /* BE: 'McuI' */
 };
 
 struct cbfs_file_attr_compression {
@@ -170,6 +171,21 @@ struct cbfs_file_attr_stageheader {
 	uint32_t memlen;	/* Total length (including BSS) in memory. */
 } __packed;
 
+/* Actual size in CBFS depends on the number of entries! */
+struct cbfs_file_attr_mcu_index {
+	uint32_t tag;
+	uint32_t len;
+	struct cbfs_mcu_index_entry {
+		uint32_t sig;		/* Processor signature (CPUID.1:EAX) */
+		uint32_t pf_offset;	/* Processor flags and update offset */
+	} entries[];
+} __packed;
+
+#define CBFS_MCU_INDEX_PF(pf_offset)		((pf_offset) >> 24)
+#define CBFS_MCU_INDEX_OFFSET(pf_offset)	((pf_offset) & 0xffffff)
+#define CBFS_MCU_INDEX_PF_OFFSET(pf, offset)	((pf) << 24 | (offset))
+#define CBFS_MCU_INDEX_MAX_OFFSET		0xffffff
+
 
 /*** Component sub-headers ***/
 
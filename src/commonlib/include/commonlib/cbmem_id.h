@@ -21,9 +21,11 @@
 #define CBMEM_ID_COVERAGE	0x47434f56
 #define CBMEM_ID_EHCI_DEBUG	0xe4c1deb9
 #define CBMEM_ID_ELOG		0x454c4f47
+#define CBMEM_ID_ELOG_INDEX	0x58494c45
 #define CBMEM_ID_FREESPACE	0x46524545
 #define CBMEM_ID_FSP_RESERVED_MEMORY 0x46535052
 #define CBMEM_ID_FSP_RUNTIME	0x52505346
+#define CBMEM_ID_FSP_HOB_INDEX	0x58494846
 #define CBMEM_ID_GDT		0x4c474454
 #define CBMEM_ID_HOB_POINTER	0x484f4221
 #define CBMEM_ID_IGD_OPREGION	0x4f444749
@@ -53,6 +55,7 @@
 #define CBMEM_ID_ROOT		0xff4007ff
 #define CBMEM_ID_SMBIOS         0x534d4254
 #define CBMEM_ID_SMM_SAVE_SPACE	0x07e9acee
+#define CBMEM_ID_SMI_LATENCY	0x534d494c
 #define CBMEM_ID_STAGEx_META	0x57a9e000
 #define CBMEM_ID_STAGEx_CACHE	0x57a9e100
 #define CBMEM_ID_STAGEx_RAW	0x57a9e200
@@ -98,9 +101,11 @@
 	{ CBMEM_ID_CPU_CRASHLOG,	"CPU CRASHLOG"}, \
 	{ CBMEM_ID_EHCI_DEBUG,		"USBDEBUG   " }, \
 	{ CBMEM_ID_ELOG,		"ELOG       " }, \
+	{ CBMEM_ID_ELOG_INDEX,		"ELOG INDEX " }, \
 	{ CBMEM_ID_FREESPACE,		"FREE SPACE " }, \
 	{ CBMEM_ID_FSP_RESERVED_MEMORY, "FSP MEMORY " }, \
 	{ CBMEM_ID_FSP_RUNTIME,		"FSP RUNTIME" }, \
+	{ CBMEM_ID_FSP_HOB_INDEX,	"FSP HOB IDX" }, \
 	{ CBMEM_ID_GDT,			"GDT        " }, \
 	{ CBMEM_ID_HOB_POINTER,		"HOB        " }, \
 	{ CBMEM_ID_IMD_ROOT,		"IMD ROOT   " }, \
@@ -127,6 +132,7 @@
 	{ CBMEM_ID_ROOT,		"CBMEM ROOT " }, \
 	{ CBMEM_ID_SMBIOS,		"SMBIOS     " }, \
 	{ CBMEM_ID_SMM_SAVE_SPACE,	"SMM BACKUP " }, \
+	{ CBMEM_ID_SMI_LATENCY,		"SMI LATENCY" }, \
 	{ CBMEM_ID_STORAGE_DATA,	"SD/MMC/eMMC" }, \
 	{ CBMEM_ID_TCPA_LOG,		"TCPA LOG   " }, \
 	{ CBMEM_ID_TCPA_TCG_LOG,	"TCPA TCGLOG" }, \
@@ -0,0 +1,29 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef __SMI_LATENCY_SERIALIZED_H__
+#define __SMI_LATENCY_SERIALIZED_H__
+
+#include <stdint.h>
+
+struct smi_latency_entry {
+	uint64_t start;		/* TSC at entry into the SMI handler */
+	uint64_t end;		/* TSC at exit from the SMI handler */
+	uint32_t source;	/* Chipset specific, eg. the SMI status bits */
+	uint16_t cpu;
+	uint16_t reserved;
+} __packed;
+
+/*
+ * Ring buffer of the most recent SMIs. The SMI handler keeps its own copy of
+ * the write position in SMRAM; entry n is stored at entries[n % max_entries]
+ * and num_recorded is updated after the entry was written.
+ */
+struct smi_latency_log {
+	uint32_t max_entries;
+	uint32_t num_recorded;
+	uint32_t tick_freq_mhz;	/* TSC frequency, 0 if unknown */
+	uint32_t reserved;
+	struct smi_latency_entry entries[0];
+} __packed;
+
+#endif
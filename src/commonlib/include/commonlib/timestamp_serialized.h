@@ -54,6 +54,12 @@ enum timestamp_id {
 	TS_END_POSTCAR = 101,
 	TS_DELAY_START = 110,
 	TS_DELAY_END = 111,
+	TS_SMM_INSTALL_RELOC_START = 120,
+	TS_SMM_INSTALL_RELOC_END = 121,
+	TS_SMM_INSTALL_PERM_START = 122,
+	TS_SMM_INSTALL_PERM_END = 123,
+	TS_SMM_RELOCATION_START = 124,
+	TS_SMM_RELOCATION_END = 125,
 
 	/* 500+ reserved for vendorcode extensions (500-600: google/chromeos) */
 	TS_START_COPYVER = 501,
@@ -123,6 +129,8 @@ enum timestamp_id {
 	TS_FSP_AFTER_END_OF_FIRMWARE = 961,
 	TS_FSP_MULTI_PHASE_SI_INIT_START = 962,
 	TS_FSP_MULTI_PHASE_SI_INIT_END = 963,
+	TS_FSP_SILICON_INIT_PARALLEL_START = 964,
+	TS_FSP_SILICON_INIT_PARALLEL_END = 965,
 	TS_FSP_MEMORY_INIT_LOAD = 970,
 	TS_FSP_SILICON_INIT_LOAD = 971,
 
@@ -187,6 +195,12 @@ static const struct timestamp_id_to_name {
 	{ TS_SELFBOOT_JUMP,	"selfboot jump" },
 	{ TS_DELAY_START,	"Forced delay start" },
 	{ TS_DELAY_END,		"Forced delay end" },
+	{ TS_SMM_INSTALL_RELOC_START,	"installing SMM relocation handler" },
+	{ TS_SMM_INSTALL_RELOC_END,	"SMM relocation handler installed" },
+	{ TS_SMM_INSTALL_PERM_START,	"installing permanent SMM handler" },
+	{ TS_SMM_INSTALL_PERM_END,	"permanent SMM handler installed" },
+	{ TS_SMM_RELOCATION_START,	"starting SMM relocation" },
+	{ TS_SMM_RELOCATION_END,	"finished SMM relocation" },
 
 	{ TS_START_COPYVER,	"starting to load verstage" },
 	{ TS_END_COPYVER,	"finished loading verstage" },
@@ -271,6 +285,12 @@ static const struct timestamp_id_to_name {
 	{ TS_FSP_BEFORE_END_OF_FIRMWARE, "calling FspNotify(EndOfFirmware)" },
 	{ TS_FSP_AFTER_END_OF_FIRMWARE,
 		"returning from FspNotify(EndOfFirmware)" },
+	{ TS_FSP_MULTI_PHASE_SI_INIT_START, "calling FspMultiPhaseSiInit" },
+	{ TS_FSP_MULTI_PHASE_SI_INIT_END, "returning from FspMultiPhaseSiInit" },
+	{ TS_FSP_SILICON_INIT_PARALLEL_START,
+		"starting work in parallel with FSP-S" },
+	{ TS_FSP_SILICON_INIT_PARALLEL_END,
+		"finished work in parallel with FSP-S" },
 
 	{ TS_FSP_MEMORY_INIT_LOAD, "loading FSP-M" },
 	{ TS_FSP_SILICON_INIT_LOAD, "loading FSP-S" },
@@ -5,8 +5,10 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <cbfs.h>
+#include <cbfs_private.h>
 #include <arch/cpu.h>
 #include <console/console.h>
+#include <endian.h>
 #include <cpu/x86/msr.h>
 #include <cpu/intel/microcode.h>
 #include <smp/spinlock.h>
@@ -150,10 +152,83 @@ static struct ext_sig_table *ucode_get_ext_sig_table(const struct microcode *uco
 	return ext_tbl;
 }
 
+static bool ucode_matches(const struct microcode *ucode, u32 sig, u32 pf)
+{
+	struct ext_sig_table *ext_tbl;
+
+	if ((ucode->sig == sig) && (ucode->pf & pf))
+		return true;
+
+	/* Check if there is extended signature table */
+	ext_tbl = ucode_get_ext_sig_table(ucode);
+
+	if (ext_tbl != NULL) {
+		int i;
+		struct ext_sig_entry *entry = (struct ext_sig_entry *)(ext_tbl + 1);
+
+		for (i = 0; i < ext_tbl->ext_sig_cnt; i++, entry++) {
+
+			if ((sig == entry->sig) && (pf & entry->pf)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+/*
+ * cbfstool indexes the microcode updates by signature in a file attribute.
+ * Returns false if there is no usable index and the blob needs to be scanned.
+ */
+static bool find_indexed_microcode(const void *ucode_updates,
+				   size_t microcode_len, u32 sig, u32 pf,
+				   const void **found)
+{
+	const struct cbfs_file_attr_mcu_index *index;
+	const struct microcode *ucode;
+	struct region_device rdev;
+	union cbfs_mdata mdata;
+	size_t i, count, offset;
+	u32 pf_offset;
+
+	if (cbfs_boot_lookup(MICROCODE_CBFS_FILE, false, &mdata, &rdev))
+		return false;
+
+	index = cbfs_find_attr(&mdata, CBFS_FILE_ATTR_TAG_MCU_INDEX, 0);
+	if (!index)
+		return false;
+
+	count = (be32toh(index->len) - sizeof(*index)) / sizeof(index->entries[0]);
+	for (i = 0; i < count; i++) {
+		pf_offset = be32toh(index->entries[i].pf_offset);
+		if (be32toh(index->entries[i].sig) != sig ||
+		    !(CBFS_MCU_INDEX_PF(pf_offset) & pf))
+			continue;
+
+		/* The index only points at the update, check it like a scan would */
+		offset = CBFS_MCU_INDEX_OFFSET(pf_offset);
+		if (microcode_len < sizeof(*ucode) ||
+		    offset > microcode_len - sizeof(*ucode))
+			return false;
+
+		ucode = (const void *)((const char *)ucode_updates + offset);
+		if ((ucode->total_size ?: 2048) > microcode_len - offset ||
+		    !ucode_matches(ucode, sig, pf))
+			return false;
+
+		*found = ucode;
+		return true;
+	}
+
+	*found = NULL;
+	return true;
+}
+
 static const void *find_cbfs_microcode(void)
 {
 	const struct microcode *ucode_updates;
-	struct ext_sig_table *ext_tbl;
+	const void *ucode_found;
 	size_t microcode_len;
 	u32 eax;
 	u32 pf, rev, sig, update_size;
@@ -178,6 +253,10 @@ static const void *find_cbfs_microcode(void)
 	printk(BIOS_DEBUG, "microcode: sig=0x%x pf=0x%x revision=0x%x\n",
 			sig, pf, rev);
 
+	if (find_indexed_microcode(ucode_updates, microcode_len, sig, pf,
+				   &ucode_found))
+		return ucode_found;
+
 	while (microcode_len >= sizeof(*ucode_updates)) {
 		/* Newer microcode updates include a size field, whereas older
 		 * containers set it at 0 and are exactly 2048 bytes long */
@@ -194,25 +273,9 @@ static const void *find_cbfs_microcode(void)
 			break;
 		}
 
-		if ((ucode_updates->sig == sig) && (ucode_updates->pf & pf))
+		if (ucode_matches(ucode_updates, sig, pf))
 			return ucode_updates;
 
-
-		/* Check if there is extended signature table */
-		ext_tbl = ucode_get_ext_sig_table(ucode_updates);
-
-		if (ext_tbl != NULL) {
-			int i;
-			struct ext_sig_entry *entry = (struct ext_sig_entry *)(ext_tbl + 1);
-
-			for (i = 0; i < ext_tbl->ext_sig_cnt; i++, entry++) {
-
-				if ((sig == entry->sig) && (pf & entry->pf)) {
-					return ucode_updates;
-				}
-			}
-		}
-
 		ucode_updates = (void *)((char *)ucode_updates + update_size);
 		microcode_len -= update_size;
 	}
@@ -306,6 +306,7 @@ static void generate_P_state_entries(int core, int cores_per_package)
 
 void generate_cpu_entries(const struct device *device)
 {
+	struct acpigen_cpu_template tmpl = { 0 };
 	int coreID, cpuID;
 	int totalcores = dev_count_cpu();
 	int cores_per_package = get_logical_cores_per_package();
@@ -316,9 +317,16 @@ void generate_cpu_entries(const struct device *device)
 
 	for (cpuID = 1; cpuID <= numcpus; cpuID++) {
 		for (coreID = 1; coreID <= cores_per_package; coreID++) {
+			const int index =
+				(cpuID - 1) * cores_per_package + coreID - 1;
+
+			/* All processors only differ in name and domains */
+			if (!acpigen_write_processor_copy(&tmpl, index,
+							  cpuID - 1, cpuID - 1))
+				continue;
+
 			/* Generate processor \_SB.CPUx */
-			acpigen_write_processor(
-				(cpuID-1)*cores_per_package+coreID-1, 0, 0);
+			acpigen_write_processor_template(&tmpl, index, 0, 0);
 
 			/* Generate P-state tables */
 			generate_P_state_entries(
@@ -331,7 +339,7 @@ void generate_cpu_entries(const struct device *device)
 			generate_T_state_entries(
 				cpuID-1, cores_per_package);
 
-			acpigen_pop_len();
+			acpigen_write_processor_template_end();
 		}
 	}
 
@@ -18,12 +18,14 @@
 #include <cpu/x86/smm.h>
 #include <cpu/x86/mp.h>
 #include <delay.h>
+#include <lib.h>
 #include <device/device.h>
 #include <device/path.h>
 #include <smp/atomic.h>
 #include <smp/spinlock.h>
 #include <symbols.h>
 #include <timer.h>
+#include <timestamp.h>
 #include <thread.h>
 
 #include <security/intel/stm/SmmStm.h>
@@ -97,6 +99,9 @@ struct sipi_params {
 	uint32_t msr_count;
 	uint32_t c_handler;
 	atomic_t ap_count;
+	uint32_t microcode_per_core;
+	uint32_t microcode_smt_shift;
+	uint32_t microcode_core_locks[8];
 } __packed;
 
 /* This also needs to match the assembly code for saved MSR encoding. */
@@ -284,6 +289,27 @@ static int save_bsp_msrs(char *start, int size)
 	return msr_count;
 }
 
+/* Number of low APIC ID bits that select the thread within a core. */
+static uint32_t smt_apic_id_shift(void)
+{
+	unsigned int threads, cores = 1;
+
+	if (cpuid_get_max_func() >= 0xb)
+		return cpuid_ext(0xb, 0).eax & 0x1f;
+
+	if (!(cpuid_edx(1) & CPUID_FEAURE_HTT))
+		return 0;
+
+	threads = (cpuid_ebx(1) >> 16) & 0xff;
+	if (cpuid_get_max_func() >= 4)
+		cores += (cpuid_ext(4, 0).eax >> 26) & 0x3f;
+
+	if (threads <= cores)
+		return 0;
+
+	return log2_ceil(threads / cores);
+}
+
 static atomic_t *load_sipi_vector(struct mp_params *mp_params)
 {
 	struct rmodule sipi_mod;
@@ -347,10 +373,15 @@ static atomic_t *load_sipi_vector(struct mp_params *mp_params)
 	/* Provide pointer to microcode patch. */
 	sp->microcode_ptr = (uintptr_t)mp_params->microcode_pointer;
 	/* Pass on ability to load microcode in parallel. */
-	if (mp_params->parallel_microcode_load)
+	sp->microcode_lock = 0;
+	sp->microcode_per_core = 0;
+	memset(sp->microcode_core_locks, 0, sizeof(sp->microcode_core_locks));
+	if (mp_params->parallel_microcode_load == MP_MICROCODE_PER_CORE) {
+		sp->microcode_per_core = 1;
+		sp->microcode_smt_shift = smt_apic_id_shift();
+	} else if (mp_params->parallel_microcode_load) {
 		sp->microcode_lock = ~0;
-	else
-		sp->microcode_lock = 0;
+	}
 	sp->c_handler = (uintptr_t)&ap_init;
 	ap_count = &sp->ap_count;
 	atomic_set(ap_count, 0);
@@ -836,22 +867,29 @@ static void load_smm_handlers(void)
 		return;
 
 	/* Install handlers. */
+	timestamp_add_now(TS_SMM_INSTALL_RELOC_START);
 	if (install_relocation_handler(mp_state.cpu_count, real_save_state_size,
 				       smm_save_state_size, mp_state.perm_smbase) < 0) {
 		printk(BIOS_ERR, "Unable to install SMM relocation handler.\n");
 		smm_disable();
 	}
+	timestamp_add_now(TS_SMM_INSTALL_RELOC_END);
 
+	timestamp_add_now(TS_SMM_INSTALL_PERM_START);
 	if (install_permanent_handler(mp_state.cpu_count, mp_state.perm_smbase,
 				      mp_state.perm_smsize, real_save_state_size,
 				      smm_save_state_size) < 0) {
 		printk(BIOS_ERR, "Unable to install SMM permanent handler.\n");
 		smm_disable();
 	}
+	timestamp_add_now(TS_SMM_INSTALL_PERM_END);
 
 	/* Ensure the SMM handlers hit DRAM before performing first SMI. */
 	wbinvd();
 
+	if (is_smm_enabled())
+		timestamp_add_now(TS_SMM_RELOCATION_START);
+
 	/*
 	 * Indicate that the SMM handlers have been loaded and MP
 	 * initialization is about to start.
@@ -870,6 +908,15 @@ static void trigger_smm_relocation(void)
 	mp_state.ops.per_cpu_smm_trigger();
 }
 
+/* The BSP only gets here after all APs are done relocating. */
+static void bsp_initialize_cpu(void)
+{
+	if (is_smm_enabled())
+		timestamp_add_now(TS_SMM_RELOCATION_END);
+
+	mp_initialize_cpu();
+}
+
 static struct mp_callback *ap_callbacks[CONFIG_MAX_CPUS];
 
 static struct mp_callback *read_callback(struct mp_callback **slot)
@@ -1049,7 +1096,7 @@ static struct mp_flight_record mp_steps[] = {
 	/* Perform SMM relocation. */
 	MP_FR_NOBLOCK_APS(trigger_smm_relocation, trigger_smm_relocation),
 	/* Initialize each CPU through the driver framework. */
-	MP_FR_BLOCK_APS(mp_initialize_cpu, mp_initialize_cpu),
+	MP_FR_BLOCK_APS(mp_initialize_cpu, bsp_initialize_cpu),
 	/* Wait for APs to finish then optionally start looking for work. */
 	MP_FR_BLOCK_APS(ap_wait_for_instruction, NULL),
 };
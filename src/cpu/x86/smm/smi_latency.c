@@ -0,0 +1,82 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <cbmem.h>
+#include <commonlib/smi_latency_serialized.h>
+#include <console/console.h>
+#include <cpu/x86/smi_latency.h>
+#include <cpu/x86/smm.h>
+#include <cpu/x86/tsc.h>
+#include <string.h>
+#include <timestamp.h>
+
+#define SMI_LATENCY_LOG_SIZE (sizeof(struct smi_latency_log) + \
+	CONFIG_SMI_LATENCY_LOG_ENTRIES * sizeof(struct smi_latency_entry))
+
+#if ENV_RAMSTAGE
+uintptr_t smi_latency_log_setup(void)
+{
+	struct smi_latency_log *log;
+
+	/* On S3 resume keep what was recorded before suspend. */
+	log = cbmem_find(CBMEM_ID_SMI_LATENCY);
+	if (log)
+		return (uintptr_t)log;
+
+	log = cbmem_add(CBMEM_ID_SMI_LATENCY, SMI_LATENCY_LOG_SIZE);
+	if (!log) {
+		printk(BIOS_ERR, "SMI latency log: Cannot allocate CBMEM entry\n");
+		return 0;
+	}
+
+	memset(log, 0, SMI_LATENCY_LOG_SIZE);
+	log->max_entries = CONFIG_SMI_LATENCY_LOG_ENTRIES;
+	if (CONFIG(COLLECT_TIMESTAMPS))
+		log->tick_freq_mhz = timestamp_tick_freq_mhz();
+
+	return (uintptr_t)log;
+}
+#endif
+
+#if ENV_SMM
+/*
+ * The log in CBMEM can be written by the OS, so everything the handler relies
+ * on is kept in SMRAM: the write position, and the size of the log is taken
+ * from Kconfig rather than from its header.
+ */
+static uint32_t num_recorded;
+static uint32_t current_source;
+static int log_checked;
+static struct smi_latency_log *smi_log;
+
+void smi_latency_set_source(uint32_t source)
+{
+	current_source = source;
+}
+
+void smi_latency_record(uintptr_t log, int cpu, uint64_t start)
+{
+	struct smi_latency_entry *entry;
+
+	if (!log_checked) {
+		log_checked = 1;
+		/* Never let the log be used to write into SMRAM. */
+		if (log && !smm_points_to_smram((void *)log, SMI_LATENCY_LOG_SIZE)) {
+			smi_log = (void *)log;
+			num_recorded = smi_log->num_recorded;
+		}
+	}
+
+	if (!smi_log)
+		return;
+
+	entry = &smi_log->entries[num_recorded % CONFIG_SMI_LATENCY_LOG_ENTRIES];
+	entry->start = start;
+	entry->cpu = cpu;
+	entry->source = current_source;
+	entry->reserved = 0;
+	current_source = 0;
+	entry->end = rdtscll();
+
+	smi_log->num_recorded = ++num_recorded;
+}
+#endif
@@ -3,6 +3,7 @@
 #include <arch/io.h>
 #include <console/console.h>
 #include <commonlib/region.h>
+#include <cpu/x86/smi_latency.h>
 #include <cpu/x86/smm.h>
 #include <rmodule.h>
 
@@ -122,6 +123,7 @@ asmlinkage void smm_handler_start(void *arg)
 	int cpu;
 	uintptr_t actual_canary;
 	uintptr_t expected_canary;
+	const uint64_t smi_start = smi_latency_start();
 
 	p = arg;
 	cpu = p->cpu;
@@ -179,6 +181,8 @@ asmlinkage void smm_handler_start(void *arg)
 			die("SMM Handler caused a stack overflow\n");
 	}
 
+	smi_latency_record(smm_runtime.smi_latency_log_ptr, cpu, smi_start);
+
 	smi_release_lock();
 
 	/* De-assert SMI# signal to allow another SMI */
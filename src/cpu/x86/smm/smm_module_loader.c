@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <rmodule.h>
+#include <cpu/x86/smi_latency.h>
 #include <cpu/x86/smm.h>
 #include <commonlib/helpers.h>
 #include <console/console.h>
@@ -138,19 +139,19 @@ static int smm_create_map(uintptr_t smbase, unsigned int num_cpus,
 		}
 	}
 
-	if (CONFIG_DEFAULT_CONSOLE_LOGLEVEL >= BIOS_DEBUG) {
+	if (CONFIG_DEFAULT_CONSOLE_LOGLEVEL >= BIOS_SPEW) {
 		seg_count = 0;
 		for (i = 0; i < num_cpus; i++) {
-			printk(BIOS_DEBUG, "CPU 0x%x\n", i);
-			printk(BIOS_DEBUG,
+			printk(BIOS_SPEW, "CPU 0x%x\n", i);
+			printk(BIOS_SPEW,
 				"    smbase %lx  entry %lx\n",
 				cpus[i].smbase, cpus[i].entry);
-			printk(BIOS_DEBUG,
+			printk(BIOS_SPEW,
 				"           ss_start %lx  code_end %lx\n",
 				cpus[i].ss_start, cpus[i].code_end);
 			seg_count++;
 			if (seg_count >= cpus_in_segment) {
-				printk(BIOS_DEBUG,
+				printk(BIOS_SPEW,
 					"-------------NEW CODE SEGMENT --------------\n");
 				seg_count = 0;
 			}
@@ -226,16 +227,18 @@ static int smm_place_entry_code(uintptr_t smbase, unsigned int num_cpus,
 	printk(BIOS_INFO, "%s: smbase %lx, stack_top %lx\n",
 		__func__, cpus[num_cpus-1].smbase, stack_top);
 
-	/* start at 1, the first CPU stub code is already there */
+	/*
+	 * Start at 1, the first CPU stub code is already there. The copies are
+	 * identical, so don't log each one: with hundreds of CPUs the console
+	 * output used to take much longer than the copies themselves.
+	 */
 	size = cpus[0].code_end - cpus[0].code_start;
-	for (i = 1; i < num_cpus; i++) {
-		memcpy((int *)cpus[i].code_start, (int *)cpus[0].code_start, size);
-		printk(BIOS_DEBUG,
-			"SMM Module: placing smm entry code at %lx,  cpu # 0x%x\n",
-			cpus[i].code_start, i);
-		printk(BIOS_DEBUG, "%s: copying from %lx to %lx 0x%x bytes\n",
-			__func__, cpus[0].code_start, cpus[i].code_start, size);
-	}
+	for (i = 1; i < num_cpus; i++)
+		memcpy((void *)cpus[i].code_start, (void *)cpus[0].code_start, size);
+
+	printk(BIOS_DEBUG, "%s: copied 0x%x bytes of entry code from %lx to %u CPUs\n",
+	       __func__, size, cpus[0].code_start, num_cpus - 1);
+
 	return 1;
 }
 
@@ -578,6 +581,7 @@ int smm_load_module(void *smram, size_t size, struct smm_loader_params *params)
 	handler_mod_params->save_state_size = params->real_cpu_save_state_size;
 	handler_mod_params->num_cpus = params->num_concurrent_stacks;
 	handler_mod_params->gnvs_ptr = (uintptr_t)acpi_get_gnvs();
+	handler_mod_params->smi_latency_log_ptr = smi_latency_log_setup();
 
 	printk(BIOS_DEBUG, "%s: smram_start: 0x%p\n",
 		 __func__, smram);
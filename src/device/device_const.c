@@ -56,10 +56,19 @@ DEVTREE_CONST struct device *dev_find_path(
 {
 	DEVTREE_CONST struct device *dev, *result = NULL;
 
-	if (prev_match == NULL)
+	if (prev_match == NULL) {
+		/* sconfig records the first devicetree device of each type. */
+		if (path_type < DEVICE_PATH_TYPES && __first_dev_of_path_type[path_type])
+			return __first_dev_of_path_type[path_type];
+
+		/* Only ramstage adds devices that are not in the devicetree. */
+		if (DEVTREE_EARLY)
+			return NULL;
+
 		prev_match = all_devices;
-	else
+	} else {
 		prev_match = prev_match->next;
+	}
 
 	for (dev = prev_match; dev; dev = dev->next) {
 		if (dev->path.type == path_type) {
@@ -273,6 +282,16 @@ DEVTREE_CONST struct bus *pci_root_bus(void)
 
 DEVTREE_CONST struct device *pcidev_path_on_root(pci_devfn_t devfn)
 {
+	DEVTREE_CONST struct device *dev = NULL;
+
+	/* Devicetree devices come from the table sconfig generates. */
+	if (devfn < ARRAY_SIZE(__pci_root_devfn_index))
+		dev = __pci_root_devs[__pci_root_devfn_index[devfn]];
+
+	/* PCI enumeration may add devices that are not in the devicetree. */
+	if (dev || DEVTREE_EARLY)
+		return dev;
+
 	return pcidev_path_behind(pci_root_bus(), devfn);
 }
 
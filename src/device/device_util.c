@@ -19,7 +19,7 @@ struct device *dev_find_lapic(unsigned int apic_id)
 	struct device *dev;
 	struct device *result = NULL;
 
-	for (dev = all_devices; dev; dev = dev->next) {
+	for (dev = dev_find_path(NULL, DEVICE_PATH_APIC); dev; dev = dev->next) {
 		if (dev->path.type == DEVICE_PATH_APIC &&
 		    dev->path.apic.apic_id == apic_id) {
 			result = dev;
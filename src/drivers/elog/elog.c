@@ -8,6 +8,7 @@
 #include <boot_device.h>
 #include <commonlib/region.h>
 #include <fmap.h>
+#include <ip_checksum.h>
 #include <lib.h>
 #include <post.h>
 #include <rtc.h>
@@ -42,6 +43,14 @@ struct elog_state {
 	size_t mirror_last_write;
 	size_t nv_last_write;
 
+	/* Offset of the last event and number of events in the mirror. */
+	size_t last_event;
+	size_t event_count;
+	/* Events in [header, nv_unread_end) haven't been read into the mirror. */
+	size_t nv_unread_end;
+	/* Nesting of elog_batch_begin() calls deferring NV updates. */
+	int batch_depth;
+
 	struct region_device nv_dev;
 	/* Device that mirrors the eventlog in memory. */
 	struct region_device mirror_dev;
@@ -51,6 +60,20 @@ struct elog_state {
 
 static struct elog_state elog_state;
 
+/*
+ * The NV storage layout is parsed by other tools and a header on flash can't
+ * be updated on every append without erasing it. So the position of the last
+ * event is handed over to later stages in CBMEM instead, which lets them start
+ * without reading and validating the whole log.
+ */
+struct elog_index {
+	u32 last_write;
+	u32 last_event;
+	u32 event_count;
+	u16 event_checksum;	/* IP checksum of the event at last_event */
+	u16 checksum;		/* IP checksum of this structure */
+} __packed;
+
 #define ELOG_SIZE (4 * KiB)
 static uint8_t elog_mirror_buf[ELOG_SIZE];
 
@@ -376,6 +399,8 @@ static int elog_update_event_buffer_state(void)
 		}
 
 		/* Move to the next event */
+		elog_state.last_event = offset;
+		elog_state.event_count++;
 		elog_tandem_increment_last_write(len);
 		offset += len;
 	}
@@ -409,6 +434,9 @@ static int elog_scan_flash(void)
 
 	/* No writes have been done yet. */
 	elog_tandem_reset_last_write();
+	elog_state.last_event = 0;
+	elog_state.event_count = 0;
+	elog_state.nv_unread_end = 0;
 
 	/* Check if the area is empty or not */
 	if (elog_is_buffer_clear(0)) {
@@ -428,6 +456,142 @@ static int elog_scan_flash(void)
 	return elog_update_event_buffer_state();
 }
 
+/* Only the stages which bring up and use CBMEM keep an index. */
+static bool elog_index_available(void)
+{
+	return (ENV_ROMSTAGE || ENV_RAMSTAGE) && cbmem_online();
+}
+
+static u16 elog_index_checksum(const struct elog_index *index)
+{
+	struct elog_index copy = *index;
+
+	copy.checksum = 0;
+	return compute_ip_checksum(&copy, sizeof(copy));
+}
+
+/*
+ * Set up the ELOG state from the index left in CBMEM by an earlier stage.
+ * Only the header and the last event are read from the NV storage and
+ * checked against the index. The events before it are read on demand by
+ * elog_mirror_load().
+ */
+static int elog_load_index(void)
+{
+	const struct elog_index *index;
+	const struct region_device *rdev = mirror_dev_get();
+	size_t size = region_device_sz(&elog_state.nv_dev);
+	size_t len, read_size;
+	uint8_t *mirror_buffer;
+	int ret = -1;
+
+	if (!elog_index_available())
+		return -1;
+
+	index = cbmem_find(CBMEM_ID_ELOG_INDEX);
+	if (index == NULL || index->checksum != elog_index_checksum(index))
+		return -1;
+
+	if (index->last_event < elog_events_start() ||
+	    index->last_event >= index->last_write || index->last_write > size)
+		return -1;
+
+	len = index->last_write - index->last_event;
+	/* Include the byte after the last event, which has to be EOL. */
+	read_size = MIN(len + 1, size - index->last_event);
+
+	mirror_buffer = rdev_mmap_full(rdev);
+	if (mirror_buffer == NULL)
+		return -1;
+
+	memset(mirror_buffer, ELOG_TYPE_EOL, size);
+	if (rdev_readat(&elog_state.nv_dev, mirror_buffer, 0,
+			elog_events_start()) < 0 ||
+	    rdev_readat(&elog_state.nv_dev, mirror_buffer + index->last_event,
+			index->last_event, read_size) < 0)
+		goto out;
+
+	if (index->last_write < size &&
+	    mirror_buffer[index->last_write] != ELOG_TYPE_EOL)
+		goto out;
+
+	if (!elog_is_header_valid() ||
+	    elog_is_event_valid(index->last_event) != len ||
+	    compute_ip_checksum(mirror_buffer + index->last_event, len) !=
+	    index->event_checksum)
+		goto out;
+
+	elog_tandem_reset_last_write();
+	elog_tandem_increment_last_write(index->last_write);
+	elog_state.last_event = index->last_event;
+	elog_state.event_count = index->event_count;
+	elog_state.nv_unread_end = index->last_event;
+
+	elog_debug("ELOG: %u events up to 0x%x from index\n",
+		   index->event_count, index->last_write);
+	ret = 0;
+out:
+	rdev_munmap(rdev, mirror_buffer);
+	return ret;
+}
+
+/* Read the events skipped by elog_load_index() into the mirror. */
+static int elog_mirror_load(void)
+{
+	const struct region_device *rdev = mirror_dev_get();
+	size_t size = elog_state.nv_unread_end;
+	void *mirror_buffer;
+
+	if (!size)
+		return 0;
+
+	mirror_buffer = rdev_mmap(rdev, 0, size);
+	if (mirror_buffer == NULL)
+		return -1;
+
+	if (rdev_readat(&elog_state.nv_dev, mirror_buffer, 0, size) != size) {
+		rdev_munmap(rdev, mirror_buffer);
+		printk(BIOS_ERR, "ELOG: NV read failure.\n");
+		return -1;
+	}
+	rdev_munmap(rdev, mirror_buffer);
+
+	elog_state.nv_unread_end = 0;
+	return 0;
+}
+
+/* Describe the NV storage in CBMEM for elog_load_index() in later stages. */
+static void elog_update_index(void)
+{
+	struct elog_index *index;
+	struct event_header *event;
+	size_t len = elog_state.mirror_last_write - elog_state.last_event;
+
+	if (!elog_index_available())
+		return;
+
+	if (elog_state.elog_initialized != ELOG_INITIALIZED ||
+	    elog_nv_needs_update() || !elog_state.event_count)
+		return;
+
+	index = cbmem_find(CBMEM_ID_ELOG_INDEX);
+	if (index == NULL)
+		index = cbmem_add(CBMEM_ID_ELOG_INDEX, sizeof(*index));
+	if (index == NULL)
+		return;
+
+	event = elog_get_event_buffer(elog_state.last_event, len);
+	if (event == NULL)
+		return;
+
+	index->last_write = elog_state.mirror_last_write;
+	index->last_event = elog_state.last_event;
+	index->event_count = elog_state.event_count;
+	index->event_checksum = compute_ip_checksum(event, len);
+	index->checksum = elog_index_checksum(index);
+	elog_put_event_buffer(event);
+}
+
 static void elog_write_header_in_mirror(void)
 {
 	static const struct elog_header header = {
@@ -507,6 +671,7 @@ static size_t elog_do_shrink(size_t requested_size, size_t last_write)
 			break;
 
 		offset += len;
+		elog_state.event_count--;
 	}
 
 	/*
@@ -536,6 +701,10 @@ static int elog_shrink_by_size(size_t requested_size)
 
 	elog_debug("%s()\n", __func__);
 
+	/* The events to keep have to be in the mirror. */
+	if (elog_mirror_load() < 0)
+		return -1;
+
 	/* Indicate possible erase required. */
 	elog_nv_needs_possible_erase();
 
@@ -546,9 +715,10 @@ static int elog_shrink_by_size(size_t requested_size)
 	elog_write_header_in_mirror();
 
 	/* Determine if any actual shrinking is required. */
-	if (requested_size >= total_event_space)
+	if (requested_size >= total_event_space) {
 		shrunk_size = total_event_space;
-	else
+		elog_state.event_count = 0;
+	} else
 		shrunk_size = elog_do_shrink(requested_size,
 						captured_last_write);
 
@@ -602,6 +772,8 @@ int elog_smbios_write_type15(unsigned long *current, int handle)
 	if (CONFIG(ELOG_CBMEM)) {
 		/* Save event log buffer into CBMEM for the OS to read */
 		void *cbmem = cbmem_add(CBMEM_ID_ELOG, elog_size);
+		if (cbmem && elog_mirror_load() < 0)
+			cbmem = NULL;
 		if (cbmem)
 			rdev_readat(mirror_dev_get(), cbmem, 0, elog_size);
 		log_address = (uintptr_t)cbmem;
@@ -711,8 +883,10 @@ static int elog_sync_to_nv(void)
 	 * If erase wasn't performed then don't rescan. Assume the appended
 	 * write was successful.
 	 */
-	if (!erase_needed)
+	if (!erase_needed) {
+		elog_update_index();
 		return 0;
+	}
 
 	elog_debug_dump_buffer("ELOG: in-memory mirror:\n");
 
@@ -724,6 +898,7 @@ static int elog_sync_to_nv(void)
 		return -1;
 	}
 
+	elog_update_index();
 	return 0;
 }
 
@@ -763,9 +938,11 @@ static void log_last_boot_post(void)
 static void elog_add_boot_count(void)
 {
 	if (elog_do_add_boot_count()) {
+		elog_batch_begin();
 		elog_add_event_dword(ELOG_TYPE_BOOT, boot_count_read());
 
 		log_last_boot_post();
+		elog_batch_end();
 	}
 }
 
@@ -807,10 +984,12 @@ int elog_init(void)
 	elog_state.elog_initialized = ELOG_INITIALIZED;
 
 	/* Load the log from flash and prepare the flash if necessary. */
-	if (elog_scan_flash() < 0 && elog_prepare_empty() < 0) {
+	if (elog_load_index() < 0 && elog_scan_flash() < 0 &&
+	    elog_prepare_empty() < 0) {
 		printk(BIOS_ERR, "ELOG: Unable to prepare flash\n");
 		return -1;
 	}
+	elog_update_index();
 
 	printk(BIOS_INFO, "ELOG: area is %zu bytes, full threshold %d,"
 	       " shrink size %d\n", region_device_sz(&elog_state.nv_dev),
@@ -894,6 +1073,8 @@ int elog_add_event_raw(u8 event_type, void *data, u8 data_size)
 	elog_update_checksum(event, -(elog_checksum_event(event)));
 	elog_put_event_buffer(event);
 
+	elog_state.last_event = elog_state.mirror_last_write;
+	elog_state.event_count++;
 	elog_mirror_increment_last_write(event_size);
 
 	printk(BIOS_INFO, "ELOG: Event(%X) added with size %d ",
@@ -910,10 +1091,31 @@ int elog_add_event_raw(u8 event_type, void *data, u8 data_size)
 	if (elog_shrink() < 0)
 		return -1;
 
+	/* Batched events are written by elog_batch_end(). */
+	if (elog_state.batch_depth)
+		return 0;
+
 	/* Ensure the updates hit the non-volatile storage. */
 	return elog_sync_to_nv();
 }
 
+void elog_batch_begin(void)
+{
+	elog_state.batch_depth++;
+}
+
+int elog_batch_end(void)
+{
+	if (elog_state.batch_depth > 0)
+		elog_state.batch_depth--;
+
+	if (elog_state.batch_depth ||
+	    elog_state.elog_initialized != ELOG_INITIALIZED)
+		return 0;
+
+	return elog_sync_to_nv();
+}
+
 int elog_add_event(u8 event_type)
 {
 	return elog_add_event_raw(event_type, NULL, 0);
@@ -957,3 +1159,10 @@ int elog_add_extended_event(u8 type, u32 complement)
 /* Make sure elog_init() runs at least once to log System Boot event. */
 static void elog_bs_init(void *unused) { elog_init(); }
 BOOT_STATE_INIT_ENTRY(BS_POST_DEVICE, BS_ON_ENTRY, elog_bs_init, NULL);
+
+/* Publish the index if the log was set up before CBMEM came online. */
+static void elog_cbmem_init(int is_recovery)
+{
+	elog_update_index();
+}
+ROMSTAGE_CBMEM_INIT_HOOK(elog_cbmem_init)
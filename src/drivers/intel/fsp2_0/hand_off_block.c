@@ -91,6 +91,99 @@ struct hob_resource *fsp_hob_header_to_resource(const struct hob_header *hob)
 
 static void *fsp_hob_list_ptr;
 
+/*
+ * The GUID extension and resource descriptor HOBs of the list, sorted by
+ * GUID and type so that lookups don't need to walk the whole HOB list. HOBs
+ * with the same GUID and type keep their order in the list.
+ */
+struct hob_index_entry {
+	uint8_t guid[16];
+	uint16_t type;
+	uint16_t reserved;
+	uint32_t offset;	/* from the start of the HOB list */
+};
+
+struct hob_index {
+	uint32_t valid;
+	uint32_t count;
+	struct hob_index_entry entries[];
+};
+
+static int hob_index_compare(const uint8_t guid[16], uint16_t type,
+			     const struct hob_index_entry *entry)
+{
+	int ret = memcmp(guid, entry->guid, sizeof(entry->guid));
+
+	if (ret)
+		return ret;
+
+	return type - entry->type;
+}
+
+static const uint8_t *hob_guid(const struct hob_header *hob)
+{
+	if (hob->type == HOB_TYPE_RESOURCE_DESCRIPTOR)
+		return fsp_hob_header_to_resource(hob)->owner_guid;
+	if (hob->type == HOB_TYPE_GUID_EXTENSION)
+		return hob_header_to_struct(hob);
+	return NULL;
+}
+
+static void save_hob_index(const struct hob_header *hob_list)
+{
+	const struct cbmem_entry *cbmem_entry;
+	const struct hob_header *hob;
+	struct hob_index_entry entry;
+	struct hob_index *index;
+	size_t count = 0;
+	size_t i;
+
+	for (hob = hob_list; hob->type != HOB_TYPE_END_OF_HOB_LIST;
+	     hob = fsp_next_hob(hob)) {
+		if (hob_guid(hob))
+			count++;
+	}
+
+	cbmem_entry = cbmem_entry_add(CBMEM_ID_FSP_HOB_INDEX, sizeof(*index) +
+				      count * sizeof(index->entries[0]));
+	if (!cbmem_entry) {
+		printk(BIOS_ERR, "Error: Could not add cbmem area for hob index.\n");
+		return;
+	}
+
+	index = cbmem_entry_start(cbmem_entry);
+	index->valid = 0;
+
+	/* On S3 resume the area of the previous boot may be too small. */
+	if (cbmem_entry_size(cbmem_entry) <
+	    sizeof(*index) + count * sizeof(index->entries[0]))
+		return;
+
+	/* Insertion sort, the list is short and partially sorted already. */
+	index->count = 0;
+	for (hob = hob_list; hob->type != HOB_TYPE_END_OF_HOB_LIST;
+	     hob = fsp_next_hob(hob)) {
+		if (!hob_guid(hob))
+			continue;
+
+		memcpy(entry.guid, hob_guid(hob), sizeof(entry.guid));
+		entry.type = hob->type;
+		entry.reserved = 0;
+		entry.offset = (uintptr_t)hob - (uintptr_t)hob_list;
+
+		for (i = index->count; i > 0; i--) {
+			if (hob_index_compare(entry.guid, entry.type,
+					      &index->entries[i - 1]) >= 0)
+				break;
+			index->entries[i] = index->entries[i - 1];
+		}
+		index->entries[i] = entry;
+		index->count++;
+	}
+
+	index->valid = 1;
+}
+
 static void save_hob_list(int is_recovery)
 {
 	uint32_t *cbmem_loc;
@@ -102,6 +195,7 @@ static void save_hob_list(int is_recovery)
 	if (!hob_list)
 		die("Error: Could not locate hob list pointer.\n");
 	*cbmem_loc = (uintptr_t)hob_list;
+	save_hob_index(hob_list);
 }
 
 ROMSTAGE_CBMEM_INIT_HOOK(save_hob_list);
@@ -121,11 +215,53 @@ void *fsp_get_hob_list_ptr(void)
 	return &fsp_hob_list_ptr;
 }
 
+/*
+ * Find the first HOB of |type| with |guid| in the index. The index only covers
+ * the HOBs FSP-M produced, FSP-S may append more. So a miss only means the
+ * caller has to walk the list.
+ */
+static const struct hob_header *find_indexed_hob(const struct hob_header *hob_list,
+						 const uint8_t guid[16],
+						 uint16_t type)
+{
+	const struct hob_index *index;
+	size_t lo, hi, mid;
+
+	if (!cbmem_possibly_online())
+		return NULL;
+
+	index = cbmem_find(CBMEM_ID_FSP_HOB_INDEX);
+	if (!index || !index->valid)
+		return NULL;
+
+	/* Binary search for the first matching entry. */
+	lo = 0;
+	hi = index->count;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (hob_index_compare(guid, type, &index->entries[mid]) > 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo == index->count ||
+	    hob_index_compare(guid, type, &index->entries[lo]) != 0)
+		return NULL;
+
+	return (const void *)((uintptr_t)hob_list + index->entries[lo].offset);
+}
+
 static const
 struct hob_resource *find_resource_hob_by_guid(const struct hob_header *hob,
 					       const uint8_t guid[16])
 {
 	const struct hob_resource *res;
+	const struct hob_header *found;
+
+	found = find_indexed_hob(hob, guid, HOB_TYPE_RESOURCE_DESCRIPTOR);
+	if (found)
+		return fsp_hob_header_to_resource(found);
 
 	for (; hob->type != HOB_TYPE_END_OF_HOB_LIST;
 		hob = fsp_next_hob(hob)) {
@@ -185,20 +321,27 @@ void fsp_find_reserved_memory(struct range_entry *re)
 
 const void *fsp_find_extension_hob_by_guid(const uint8_t *guid, size_t *size)
 {
-	const uint8_t *hob_guid;
+	const uint8_t *guid_ext;
 	const struct hob_header *hob = fsp_get_hob_list();
+	const struct hob_header *found;
 
 	if (!hob)
 		return NULL;
 
+	found = find_indexed_hob(hob, guid, HOB_TYPE_GUID_EXTENSION);
+	if (found) {
+		*size = found->length - (HOB_HEADER_LEN + 16);
+		return hob_header_to_extension_hob(found);
+	}
+
 	for (; hob->type != HOB_TYPE_END_OF_HOB_LIST;
 		hob = fsp_next_hob(hob)) {
 
 		if (hob->type != HOB_TYPE_GUID_EXTENSION)
 			continue;
 
-		hob_guid = hob_header_to_struct(hob);
-		if (fsp_guid_compare(hob_guid, guid)) {
+		guid_ext = hob_header_to_struct(hob);
+		if (fsp_guid_compare(guid_ext, guid)) {
 			*size = hob->length - (HOB_HEADER_LEN + 16);
 			return hob_header_to_extension_hob(hob);
 		}
@@ -286,7 +429,6 @@ void fsp_display_fvi_version_hob(void)
 {
 	const uint8_t *hob_uuid;
 	const struct hob_header *hob = fsp_get_hob_list();
-	size_t size;
 
 	if (!hob)
 		return;
@@ -299,10 +441,8 @@ void fsp_display_fvi_version_hob(void)
 
 		hob_uuid = hob_header_to_struct(hob);
 
-		if (fsp_guid_compare(hob_uuid, uuid_fv_info)) {
-			size = hob->length - (HOB_HEADER_LEN + 16);
+		if (fsp_guid_compare(hob_uuid, uuid_fv_info))
 			display_fsp_version_info_hob(hob);
-		}
 	}
 }
 
@@ -3,6 +3,7 @@
 #ifndef _FSP2_0_API_H_
 #define _FSP2_0_API_H_
 
+#include <bootstate.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <fsp/soc_binding.h>
@@ -49,6 +50,20 @@ void platform_fsp_silicon_init_params_cb(FSPS_UPD *supd);
 void platform_fsp_multi_phase_init_cb(uint32_t phase_index);
 /* Check if SoC sets EnableMultiPhaseSiliconInit UPD */
 int soc_fsp_multi_phase_init_is_enable(void);
+/*
+ * Callback for SoC/Mainboard to start work which doesn't depend on FSP-S
+ * using fsp_silicon_init_run_parallel(). Called before FspSiliconInit().
+ * The work only runs while coreboot waits between or around FSP calls.
+ */
+void platform_fsp_silicon_init_parallel_cb(void);
+/*
+ * Run func(arg) on a cooperative thread while silicon init is in progress.
+ * With FSP_SILICON_INIT_PARALLEL_WORK disabled or no free thread, func is
+ * called right away. The boot state machine doesn't enter (state, seq)
+ * before func has returned.
+ */
+void fsp_silicon_init_run_parallel(void (*func)(void *), void *arg,
+				   boot_state_t state, boot_state_sequence_t seq);
 /*
  * The following functions are used when FSP_PLATFORM_MEMORY_SETTINGS_VERSION
  * is employed allowing the mainboard and SoC to supply their own version
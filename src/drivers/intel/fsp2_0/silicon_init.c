@@ -11,7 +11,9 @@
 #include <program_loading.h>
 #include <soc/intel/common/vbt.h>
 #include <stage_cache.h>
+#include <stdlib.h>
 #include <string.h>
+#include <thread.h>
 #include <timestamp.h>
 #include <types.h>
 #include <mode_switch.h>
@@ -34,6 +36,62 @@ int __weak soc_fsp_multi_phase_init_is_enable(void)
 	return 1;
 }
 
+void __weak platform_fsp_silicon_init_parallel_cb(void)
+{
+	/* Leave for the SoC/Mainboard to implement if necessary. */
+}
+
+struct parallel_work {
+	void (*func)(void *);
+	void *arg;
+};
+
+static void run_parallel_work(void *arg)
+{
+	struct parallel_work *work = arg;
+
+	timestamp_add_now(TS_FSP_SILICON_INIT_PARALLEL_START);
+	work->func(work->arg);
+	timestamp_add_now(TS_FSP_SILICON_INIT_PARALLEL_END);
+	free(work);
+}
+
+void fsp_silicon_init_run_parallel(void (*func)(void *), void *arg,
+				   boot_state_t state, boot_state_sequence_t seq)
+{
+	struct parallel_work *work;
+
+	if (CONFIG(FSP_SILICON_INIT_PARALLEL_WORK)) {
+		work = xmalloc(sizeof(*work));
+		work->func = func;
+		work->arg = arg;
+		if (!thread_run_until(run_parallel_work, work, state, seq))
+			return;
+		free(work);
+	}
+
+	func(arg);
+}
+
+/*
+ * FSP is not reentrant. Don't switch threads if it calls back into coreboot
+ * code which waits, e.g. through the MP services PPI.
+ */
+static void parallel_work_pause(void)
+{
+	if (CONFIG(FSP_SILICON_INIT_PARALLEL_WORK))
+		thread_prevent_coop();
+}
+
+/* Resume and give the threads a chance to run before the next FSP call. */
+static void parallel_work_resume(void)
+{
+	if (CONFIG(FSP_SILICON_INIT_PARALLEL_WORK)) {
+		thread_cooperate();
+		thread_yield_microseconds(0);
+	}
+}
+
 /* FSP Specification < 2.2 has only 1 stage like FspSiliconInit. FSP specification >= 2.2
  * has multiple stages as below.
  */
@@ -113,6 +171,9 @@ static void do_silicon_init(struct fsp_header *hdr)
 	if (CONFIG(BMP_LOGO))
 		soc_load_logo(upd);
 
+	/* Start work which can run while FSP-S is busy */
+	platform_fsp_silicon_init_parallel_cb();
+
 	/* Call SiliconInit */
 	silicon_init = (void *) (uintptr_t)(hdr->image_base +
 				 hdr->silicon_init_entry_offset);
@@ -121,10 +182,12 @@ static void do_silicon_init(struct fsp_header *hdr)
 	timestamp_add_now(TS_FSP_SILICON_INIT_START);
 	post_code(POST_FSP_SILICON_INIT);
 
+	parallel_work_pause();
 	if (ENV_X86_64 && CONFIG(PLATFORM_USES_FSP2_X86_32))
 		status = protected_mode_call_1arg(silicon_init, (uintptr_t)upd);
 	else
 		status = silicon_init(upd);
+	parallel_work_resume();
 
 	printk(BIOS_ERR, "FSPS returned %x\n", status);
 
@@ -162,7 +225,9 @@ static void do_silicon_init(struct fsp_header *hdr)
 	multi_phase_params.multi_phase_action = GET_NUMBER_OF_PHASES;
 	multi_phase_params.phase_index = 0;
 	multi_phase_params.multi_phase_param_ptr = &multi_phase_get_number;
+	parallel_work_pause();
 	status = multi_phase_si_init(&multi_phase_params);
+	parallel_work_resume();
 	fsps_return_value_handler(FSP_MULTI_PHASE_SI_INIT_GET_NUMBER_OF_PHASES_API, status);
 
 	/* Execute Multi Phase Execution */
@@ -177,7 +242,9 @@ static void do_silicon_init(struct fsp_header *hdr)
 		multi_phase_params.multi_phase_action = EXECUTE_PHASE;
 		multi_phase_params.phase_index = i;
 		multi_phase_params.multi_phase_param_ptr = NULL;
+		parallel_work_pause();
 		status = multi_phase_si_init(&multi_phase_params);
+		parallel_work_resume();
 		fsps_return_value_handler(FSP_MULTI_PHASE_SI_INIT_EXECUTE_PHASE_API, status);
 	}
 	timestamp_add_now(TS_FSP_MULTI_PHASE_SI_INIT_END);
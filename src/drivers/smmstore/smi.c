@@ -60,6 +60,23 @@ static uint32_t smmstorev1_exec(uint8_t command, void *param)
 		break;
 	}
 
+	case SMMSTORE_CMD_LOOKUP: {
+		printk(BIOS_DEBUG, "Looking up key in SMM store\n");
+		struct smmstore_params_lookup *params = param;
+
+		if (range_check(params, sizeof(*params)) != 0)
+			break;
+		if (range_check(params->key, params->keysize) != 0)
+			break;
+		if (range_check(params->buf, params->bufsize) != 0)
+			break;
+
+		if (smmstore_lookup_data(params->key, params->keysize,
+					 params->buf, &params->bufsize) == 0)
+			ret = SMMSTORE_RET_SUCCESS;
+		break;
+	}
+
 	case SMMSTORE_CMD_CLEAR: {
 		if (smmstore_clear_region() == 0)
 			ret = SMMSTORE_RET_SUCCESS;
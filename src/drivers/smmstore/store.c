@@ -7,6 +7,7 @@
 #include <commonlib/region.h>
 #include <console/console.h>
 #include <smmstore.h>
+#include <string.h>
 #include <types.h>
 
 /*
@@ -121,62 +122,436 @@ int smmstore_read_region(void *buf, ssize_t *bufsize)
 	return 0;
 }
 
-static enum cb_err scan_end(struct region_device *store)
+/*
+ * Index of the log, kept in SMRAM. It is built by walking the log once and
+ * then kept up to date by the append and clear commands, so appends don't
+ * have to search for the end marker and lookups only read the entry they
+ * return. Every command revalidates it against the flash contents with two
+ * small reads, so it is rebuilt if the store changed underneath (eg. due to
+ * an update).
+ */
+#define INDEX_SLOT_EMPTY	0xffffffff
+#define INDEX_CHUNK_SIZE	64
+
+struct smmstore_entry_hdr {
+	uint32_t key_sz;
+	uint32_t value_sz;
+} __packed;
+
+struct smmstore_index_slot {
+	uint32_t hash;
+	uint32_t offset;	/* of the latest valid entry with this key */
+};
+
+static struct {
+	bool valid;
+	/* More keys than slots, lookups have to walk the log. */
+	bool overflow;
+	struct region region;
+	/* Offset of the end marker */
+	size_t end;
+	/* Offset of the last entry, equal to end if the log is empty */
+	size_t last;
+	struct smmstore_index_slot slots[CONFIG_SMMSTORE_INDEX_ENTRIES];
+} store_index;
+
+static size_t entry_size(uint32_t key_sz, uint32_t value_sz)
+{
+	return ALIGN_UP(sizeof(struct smmstore_entry_hdr) + key_sz + value_sz + 1,
+			sizeof(uint32_t));
+}
+
+/* FNV-1a */
+static uint32_t key_hash_update(uint32_t hash, const uint8_t *data, size_t size)
+{
+	while (size--) {
+		hash ^= *data++;
+		hash *= 16777619;
+	}
+
+	return hash;
+}
+
+#define KEY_HASH_INIT	2166136261
+
+/* Hash |size| bytes at |offset| of |rdev|. Returns 0 on success. */
+static int key_hash(const struct region_device *rdev, size_t offset, size_t size,
+		    uint32_t *hash)
+{
+	uint8_t buf[INDEX_CHUNK_SIZE];
+	size_t chunk;
+
+	*hash = KEY_HASH_INIT;
+	while (size) {
+		chunk = MIN(size, sizeof(buf));
+		if (rdev_readat(rdev, buf, offset, chunk) != chunk)
+			return -1;
+		*hash = key_hash_update(*hash, buf, chunk);
+		offset += chunk;
+		size -= chunk;
+	}
+
+	return 0;
+}
+
+/*
+ * Compare the key of the entry at |offset| in the store with the |key_sz|
+ * bytes at |key_offset| of |key|, which is either the store itself or a
+ * buffer provided by the caller.
+ */
+static bool key_matches(const struct region_device *store, size_t offset,
+			const struct region_device *key, size_t key_offset,
+			uint32_t key_sz)
+{
+	uint8_t a[INDEX_CHUNK_SIZE], b[INDEX_CHUNK_SIZE];
+	struct smmstore_entry_hdr hdr;
+	size_t chunk;
+
+	if (rdev_readat(store, &hdr, offset, sizeof(hdr)) != sizeof(hdr))
+		return false;
+
+	if (hdr.key_sz != key_sz)
+		return false;
+
+	offset += sizeof(hdr);
+	while (key_sz) {
+		chunk = MIN(key_sz, sizeof(a));
+		if (rdev_readat(store, a, offset, chunk) != chunk ||
+		    rdev_readat(key, b, key_offset, chunk) != chunk)
+			return false;
+		if (memcmp(a, b, chunk))
+			return false;
+		offset += chunk;
+		key_offset += chunk;
+		key_sz -= chunk;
+	}
+
+	return true;
+}
+
+/*
+ * Find the slot of the key, or the empty slot it would go into. Returns NULL
+ * if the key is not in the index and there is no space left for it.
+ */
+static struct smmstore_index_slot *index_find(const struct region_device *store,
+					      uint32_t hash,
+					      const struct region_device *key,
+					      size_t key_offset, uint32_t key_sz)
+{
+	const size_t num_slots = ARRAY_SIZE(store_index.slots);
+	struct smmstore_index_slot *slot;
+	size_t i, n;
+
+	for (i = hash % num_slots, n = 0; n < num_slots; i = (i + 1) % num_slots, n++) {
+		slot = &store_index.slots[i];
+		if (slot->offset == INDEX_SLOT_EMPTY)
+			return slot;
+		if (slot->hash == hash &&
+		    key_matches(store, slot->offset, key, key_offset, key_sz))
+			return slot;
+	}
+
+	return NULL;
+}
+
+/* Record the valid entry at |offset| as the latest one for its key. */
+static void index_insert(const struct region_device *store, size_t offset,
+			 uint32_t key_sz)
+{
+	struct smmstore_index_slot *slot;
+	uint32_t hash;
+
+	if (store_index.overflow)
+		return;
+
+	if (key_hash(store, offset + sizeof(struct smmstore_entry_hdr), key_sz,
+		     &hash) < 0) {
+		store_index.overflow = true;
+		return;
+	}
+
+	slot = index_find(store, hash, store, offset + sizeof(struct smmstore_entry_hdr),
+			  key_sz);
+	if (!slot) {
+		printk(BIOS_INFO, "smm store: index full, falling back to log walks\n");
+		store_index.overflow = true;
+		return;
+	}
+
+	slot->hash = hash;
+	slot->offset = offset;
+}
+
+static void index_reset(const struct region *region)
+{
+	memset(store_index.slots, 0xff, sizeof(store_index.slots));
+	store_index.overflow = false;
+	store_index.region = *region;
+	store_index.end = 0;
+	store_index.last = 0;
+	store_index.valid = true;
+}
+
+/* Walk the whole log, indexing all valid entries and locating the end. */
+static enum cb_err index_build(const struct region_device *store,
+			       const struct region *region)
 {
-	/* scan for end */
-	ssize_t end = 0;
-	uint32_t k_sz, v_sz;
-	const ssize_t data_sz = region_device_sz(store);
+	const size_t data_sz = region_device_sz(store);
+	struct smmstore_entry_hdr hdr;
+	size_t end = 0;
+	uint8_t active;
+
+	index_reset(region);
+	store_index.valid = false;
+
 	while (end < data_sz) {
 		/* make odd corner cases identifiable, eg. invalid v_sz */
-		k_sz = 0;
+		hdr.key_sz = 0;
 
-		if (rdev_readat(store, &k_sz, end, sizeof(k_sz)) < 0) {
+		if (rdev_readat(store, &hdr.key_sz, end, sizeof(hdr.key_sz)) < 0) {
 			printk(BIOS_WARNING, "failed reading key size\n");
 			return CB_ERR;
 		}
 
 		/* found the end */
-		if (k_sz == 0xffffffff)
+		if (hdr.key_sz == 0xffffffff)
 			break;
 
 		/* something is fishy here:
 		 * Avoid wrapping (since data_size < MAX_UINT32_T / 2) while
 		 * other problems are covered by the loop condition
 		 */
-		if (k_sz > data_sz) {
+		if (hdr.key_sz > data_sz) {
 			printk(BIOS_WARNING, "key size out of bounds\n");
 			return CB_ERR;
 		}
 
-		if (rdev_readat(store, &v_sz, end + sizeof(k_sz), sizeof(v_sz)) < 0) {
+		if (rdev_readat(store, &hdr.value_sz, end + sizeof(hdr.key_sz),
+				sizeof(hdr.value_sz)) < 0) {
 			printk(BIOS_WARNING, "failed reading value size\n");
 			return CB_ERR;
 		}
 
-		if (v_sz > data_sz) {
+		if (hdr.value_sz > data_sz) {
 			printk(BIOS_WARNING, "value size out of bounds\n");
 			return CB_ERR;
 		}
 
-		end += sizeof(k_sz) + sizeof(v_sz) + k_sz + v_sz + 1;
-		end = ALIGN_UP(end, sizeof(uint32_t));
+		/* Entries that were not completely written are ignored. */
+		if (rdev_readat(store, &active,
+				end + sizeof(hdr) + hdr.key_sz + hdr.value_sz,
+				sizeof(active)) == sizeof(active) && active == 0)
+			index_insert(store, end, hdr.key_sz);
+
+		store_index.last = end;
+		end += entry_size(hdr.key_sz, hdr.value_sz);
 	}
 
 	printk(BIOS_DEBUG, "used smm store size might be 0x%zx bytes\n", end);
 
-	if (k_sz != 0xffffffff) {
+	if (hdr.key_sz != 0xffffffff) {
 		printk(BIOS_WARNING,
-			"eof of data marker looks invalid: 0x%x\n", k_sz);
+			"eof of data marker looks invalid: 0x%x\n", hdr.key_sz);
 		return CB_ERR;
 	}
 
-	if (rdev_chain(store, store, end, data_sz - end))
-		return CB_ERR;
+	store_index.end = end;
+	if (end == 0)
+		store_index.last = 0;
+	store_index.valid = true;
 
 	return CB_SUCCESS;
+}
+
+/*
+ * Check that the index still describes the store: it's at the same location,
+ * the end marker is where it used to be and the last entry leads up to it.
+ */
+static bool index_matches(const struct region_device *store,
+			  const struct region *region)
+{
+	struct smmstore_entry_hdr hdr;
+	uint32_t marker;
 
+	if (!store_index.valid)
+		return false;
+
+	if (region_offset(region) != region_offset(&store_index.region) ||
+	    region_sz(region) != region_sz(&store_index.region))
+		return false;
+
+	if (rdev_readat(store, &marker, store_index.end, sizeof(marker)) != sizeof(marker) ||
+	    marker != 0xffffffff)
+		return false;
+
+	if (store_index.last == store_index.end)
+		return true;
+
+	if (rdev_readat(store, &hdr, store_index.last, sizeof(hdr)) != sizeof(hdr))
+		return false;
+
+	return hdr.key_sz <= region_sz(region) && hdr.value_sz <= region_sz(region) &&
+		store_index.last + entry_size(hdr.key_sz, hdr.value_sz) == store_index.end;
 }
+
+/*
+ * Like lookup_store(), but also make sure the index is usable.
+ *
+ * returns 0 on success, -1 on failure
+ */
+static int lookup_indexed_store(struct region_device *rstore)
+{
+	struct region region;
+
+	if (lookup_store_region(&region) != CB_SUCCESS)
+		return -1;
+
+	if (lookup_store(rstore) < 0)
+		return -1;
+
+	if (index_matches(rstore, &region))
+		return 0;
+
+	if (index_build(rstore, &region) != CB_SUCCESS)
+		return -1;
+
+	return 0;
+}
+
+/*
+ * Find the latest valid entry for the key, walking the log if the index
+ * overflowed.
+ *
+ * returns the offset of the entry or -1 if there is none
+ */
+static ssize_t find_entry(const struct region_device *store, const void *key,
+			  uint32_t key_sz)
+{
+	struct smmstore_index_slot *slot;
+	struct smmstore_entry_hdr hdr;
+	struct region_device key_rdev;
+	ssize_t found = -1;
+	size_t offset;
+	uint8_t active;
+
+	if (rdev_chain_mem(&key_rdev, key, key_sz))
+		return -1;
+
+	if (!store_index.overflow) {
+		slot = index_find(store, key_hash_update(KEY_HASH_INIT, key, key_sz),
+				  &key_rdev, 0, key_sz);
+		if (!slot || slot->offset == INDEX_SLOT_EMPTY)
+			return -1;
+		return slot->offset;
+	}
+
+	for (offset = 0; offset < store_index.end;
+	     offset += entry_size(hdr.key_sz, hdr.value_sz)) {
+		if (rdev_readat(store, &hdr, offset, sizeof(hdr)) != sizeof(hdr))
+			return -1;
+
+		if (rdev_readat(store, &active,
+				offset + sizeof(hdr) + hdr.key_sz + hdr.value_sz,
+				sizeof(active)) != sizeof(active) || active != 0)
+			continue;
+
+		if (key_matches(store, offset, &key_rdev, 0, key_sz))
+			found = offset;
+	}
+
+	return found;
+}
+
+/* Check whether the entry at |offset| holds exactly this value. */
+static bool value_matches(const struct region_device *store, size_t offset,
+			  uint32_t key_sz, const uint8_t *value, uint32_t value_sz)
+{
+	uint8_t buf[INDEX_CHUNK_SIZE];
+	struct smmstore_entry_hdr hdr;
+	size_t chunk;
+
+	if (rdev_readat(store, &hdr, offset, sizeof(hdr)) != sizeof(hdr) ||
+	    hdr.value_sz != value_sz)
+		return false;
+
+	offset += sizeof(hdr) + key_sz;
+	while (value_sz) {
+		chunk = MIN(value_sz, sizeof(buf));
+		if (rdev_readat(store, buf, offset, chunk) != chunk ||
+		    memcmp(buf, value, chunk))
+			return false;
+		offset += chunk;
+		value += chunk;
+		value_sz -= chunk;
+	}
+
+	return true;
+}
+
+/*
+ * Read the latest value stored for a key
+ *
+ * Returns 0 on success, -1 on failure or if the key is not present.
+ * If the value is larger than `*bufsize` nothing is copied and -1 is
+ * returned, in both cases `*bufsize` is updated to the size of the value.
+ */
+int smmstore_lookup_data(void *key, uint32_t key_sz, void *buf, ssize_t *bufsize)
+{
+	struct region_device store;
+	struct smmstore_entry_hdr hdr;
+	ssize_t offset;
+
+	if (bufsize == NULL || *bufsize < 0)
+		return -1;
+
+	if (lookup_indexed_store(&store) < 0) {
+		printk(BIOS_WARNING, "reading region failed\n");
+		return -1;
+	}
+
+	offset = find_entry(&store, key, key_sz);
+	if (offset < 0)
+		return -1;
+
+	if (rdev_readat(&store, &hdr, offset, sizeof(hdr)) != sizeof(hdr))
+		return -1;
+
+	if (hdr.value_sz > *bufsize) {
+		*bufsize = hdr.value_sz;
+		return -1;
+	}
+
+	*bufsize = hdr.value_sz;
+	if (rdev_readat(&store, buf, offset + sizeof(hdr) + hdr.key_sz,
+			hdr.value_sz) != hdr.value_sz)
+		return -1;
+
+	return 0;
+}
+
+/* Record the entry just written at |offset| as the latest one for its key. */
+static void index_update(const struct region_device *store, void *key,
+			 uint32_t key_sz, size_t offset)
+{
+	struct smmstore_index_slot *slot = NULL;
+	struct region_device key_rdev;
+	const uint32_t hash = key_hash_update(KEY_HASH_INIT, key, key_sz);
+
+	if (store_index.overflow)
+		return;
+
+	if (rdev_chain_mem(&key_rdev, key, key_sz) == 0)
+		slot = index_find(store, hash, &key_rdev, 0, key_sz);
+
+	if (!slot) {
+		store_index.overflow = true;
+		return;
+	}
+
+	slot->hash = hash;
+	slot->offset = offset;
+}
+
 /*
  * Append data to region
  *
@@ -185,9 +560,10 @@ static enum cb_err scan_end(struct region_device *store)
 int smmstore_append_data(void *key, uint32_t key_sz, void *value,
 			 uint32_t value_sz)
 {
-	struct region_device store;
+	struct region_device store, entry;
+	ssize_t latest;
 
-	if (lookup_store(&store) < 0) {
+	if (lookup_indexed_store(&store) < 0) {
 		printk(BIOS_WARNING, "reading region failed\n");
 		return -1;
 	}
@@ -195,48 +571,65 @@ int smmstore_append_data(void *key, uint32_t key_sz, void *value,
 	ssize_t offset = 0;
 	ssize_t size;
 	uint8_t nul = 0;
-	if (scan_end(&store) != CB_SUCCESS)
-		return -1;
 
 	printk(BIOS_DEBUG, "used size looks legit\n");
 
+	/* Don't spend flash on rewriting the value that is already there. */
+	latest = find_entry(&store, key, key_sz);
+	if (latest >= 0 && value_matches(&store, latest, key_sz, value, value_sz)) {
+		printk(BIOS_DEBUG, "smm store: value unchanged, skipping append\n");
+		return 0;
+	}
+
+	if (rdev_chain(&entry, &store, store_index.end,
+		       region_device_sz(&store) - store_index.end))
+		return -1;
+
 	printk(BIOS_DEBUG, "open (%zx, %zx) for writing\n",
-		region_device_offset(&store), region_device_sz(&store));
+		region_device_offset(&entry), region_device_sz(&entry));
 
 	size = sizeof(key_sz) + sizeof(value_sz) + key_sz + value_sz
 		+ sizeof(nul);
-	if (rdev_chain(&store, &store, 0, size)) {
+	if (rdev_chain(&entry, &entry, 0, size)) {
 		printk(BIOS_WARNING, "not enough space for new data\n");
 		return -1;
 	}
 
-	if (rdev_writeat(&store, &key_sz, offset, sizeof(key_sz))
+	/* Until the entry is complete the end of the log is unknown. */
+	store_index.valid = false;
+
+	if (rdev_writeat(&entry, &key_sz, offset, sizeof(key_sz))
 	    != sizeof(key_sz)) {
 		printk(BIOS_WARNING, "failed writing key size\n");
 		return -1;
 	}
 	offset += sizeof(key_sz);
-	if (rdev_writeat(&store, &value_sz, offset, sizeof(value_sz))
+	if (rdev_writeat(&entry, &value_sz, offset, sizeof(value_sz))
 	    != sizeof(value_sz)) {
 		printk(BIOS_WARNING, "failed writing value size\n");
 		return -1;
 	}
 	offset += sizeof(value_sz);
-	if (rdev_writeat(&store, key, offset, key_sz) != key_sz) {
+	if (rdev_writeat(&entry, key, offset, key_sz) != key_sz) {
 		printk(BIOS_WARNING, "failed writing key data\n");
 		return -1;
 	}
 	offset += key_sz;
-	if (rdev_writeat(&store, value, offset, value_sz) != value_sz) {
+	if (rdev_writeat(&entry, value, offset, value_sz) != value_sz) {
 		printk(BIOS_WARNING, "failed writing value data\n");
 		return -1;
 	}
 	offset += value_sz;
-	if (rdev_writeat(&store, &nul, offset, sizeof(nul)) != sizeof(nul)) {
+	if (rdev_writeat(&entry, &nul, offset, sizeof(nul)) != sizeof(nul)) {
 		printk(BIOS_WARNING, "failed writing termination\n");
 		return -1;
 	}
 
+	store_index.last = store_index.end;
+	store_index.end += entry_size(key_sz, value_sz);
+	store_index.valid = true;
+	index_update(&store, key, key_sz, store_index.last);
+
 	return 0;
 }
 
@@ -248,18 +641,24 @@ int smmstore_append_data(void *key, uint32_t key_sz, void *value,
 int smmstore_clear_region(void)
 {
 	struct region_device store;
+	struct region region;
 
-	if (lookup_store(&store) < 0) {
+	if (lookup_store_region(&region) != CB_SUCCESS ||
+	    lookup_store(&store) < 0) {
 		printk(BIOS_WARNING, "smm store: reading region failed\n");
 		return -1;
 	}
 
+	store_index.valid = false;
+
 	ssize_t res = rdev_eraseat(&store, 0, region_device_sz(&store));
 	if (res != region_device_sz(&store)) {
 		printk(BIOS_WARNING, "smm store: erasing region failed\n");
 		return -1;
 	}
 
+	index_reset(&region);
+
 	return 0;
 }
 
@@ -371,6 +371,34 @@ inline void acpigen_write_processor_end(void)
 {
 	acpigen_pop_len();
 }
+
+/*
+ * Large systems have hundreds of Processor() objects that only differ in
+ * their name, ProcID and _PSD/_TSD domains. Generate the first one as a
+ * template and stamp out the others with acpigen_write_processor_copy():
+ *
+ *	acpigen_write_processor_template(&tmpl, 0, 0, 0);
+ *	... write _PSD, _TSD and everything else the processor needs ...
+ *	acpigen_write_processor_template_end();
+ *
+ *	acpigen_write_processor_copy(&tmpl, 1, psd_domain, tsd_domain);
+ */
+struct acpigen_cpu_template {
+	char *start;
+	/* Offsets of the fields to patch relative to start, 0 if absent */
+	size_t name_offset;
+	size_t name_size;
+	size_t id_offset;
+	size_t psd_domain_offset;
+	size_t tsd_domain_offset;
+};
+void acpigen_write_processor_template(struct acpigen_cpu_template *tmpl,
+				      u8 cpuindex, u32 pblock_addr,
+				      u8 pblock_len);
+void acpigen_write_processor_template_end(void);
+/* Returns -1 if the processor cannot be copied from the template. */
+int acpigen_write_processor_copy(const struct acpigen_cpu_template *tmpl,
+				 u8 cpuindex, u32 psd_domain, u32 tsd_domain);
 void acpigen_write_processor_package(const char *name,
 				     unsigned int first_core,
 				     unsigned int core_count);
@@ -13,6 +13,20 @@
 struct cpu_info;
 struct bus;
 
+/*
+ * Values for the |parallel| argument of get_microcode_info(). Any other
+ * non-zero value means MP_MICROCODE_PARALLEL.
+ */
+#define MP_MICROCODE_SERIAL	0	/* One AP at a time */
+#define MP_MICROCODE_PARALLEL	1	/* All APs at once */
+/*
+ * One thread per core at a time, using a lock bit per core selected by the
+ * initial APIC ID without its SMT bits. As the 8-bit initial APIC IDs alias
+ * on x2APIC systems, several cores may share a bit. Platforms have to know
+ * that loading on different cores at the same time works for them.
+ */
+#define MP_MICROCODE_PER_CORE	2
+
 static inline void mfence(void)
 {
 	__asm__ __volatile__("mfence\t\n": : :"memory");
@@ -43,7 +57,7 @@ struct mp_ops {
 				size_t *smm_save_state_size);
 	/*
 	 * Optionally fill in pointer to microcode and indicate if the APs
-	 * can load the microcode in parallel.
+	 * can load the microcode in parallel, see MP_MICROCODE_*.
 	 */
 	void (*get_microcode_info)(const void **microcode, int *parallel);
 	/*
@@ -0,0 +1,31 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef CPU_X86_SMI_LATENCY_H
+#define CPU_X86_SMI_LATENCY_H
+
+#include <cpu/x86/tsc.h>
+#include <stdint.h>
+
+#if CONFIG(SMI_LATENCY_LOG)
+/* Allocate the log in CBMEM. Returns its address or 0 on failure. */
+uintptr_t smi_latency_log_setup(void);
+
+/* TSC at SMI entry, to be passed to smi_latency_record() on exit. */
+static inline uint64_t smi_latency_start(void)
+{
+	return rdtscll();
+}
+
+/* Tag the current SMI, eg. with the status bits of its source. */
+void smi_latency_set_source(uint32_t source);
+
+/* Append the current SMI to the log at |log|, which ramstage allocated. */
+void smi_latency_record(uintptr_t log, int cpu, uint64_t start);
+#else
+static inline uintptr_t smi_latency_log_setup(void) { return 0; }
+static inline uint64_t smi_latency_start(void) { return 0; }
+static inline void smi_latency_set_source(uint32_t source) {}
+static inline void smi_latency_record(uintptr_t log, int cpu, uint64_t start) {}
+#endif
+
+#endif /* CPU_X86_SMI_LATENCY_H */
@@ -61,6 +61,7 @@ struct smm_runtime {
 	u32 save_state_size;
 	u32 num_cpus;
 	u32 gnvs_ptr;
+	u32 smi_latency_log_ptr;
 	uintptr_t save_state_top[CONFIG_MAX_CPUS];
 } __packed;
 
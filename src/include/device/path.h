@@ -25,10 +25,12 @@ enum device_path_type {
 
 	/*
 	 * When adding path types to this table, please also update the
-	 * DEVICE_PATH_NAMES macro below.
+	 * DEVICE_PATH_NAMES and DEVICE_PATH_TYPES macros below.
 	 */
 };
 
+#define DEVICE_PATH_TYPES (DEVICE_PATH_GPIO + 1)
+
 #define DEVICE_PATH_NAMES {			\
 		"DEVICE_PATH_NONE",		\
 		"DEVICE_PATH_ROOT",		\
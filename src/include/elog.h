@@ -224,6 +224,13 @@ extern int elog_add_event_dword(u8 event_type, u32 data);
 extern int elog_add_event_wake(u8 source, u32 instance);
 extern int elog_smbios_write_type15(unsigned long *current, int handle);
 extern int elog_add_extended_event(u8 type, u32 complement);
+/*
+ * Events added between elog_batch_begin() and elog_batch_end() are only
+ * written to flash by the latter, in a single program operation. Batches
+ * nest. elog_batch_end() returns < 0 on failure and 0 on success.
+ */
+extern void elog_batch_begin(void);
+extern int elog_batch_end(void);
 #else
 /* Stubs to help avoid littering sources with #if CONFIG_ELOG */
 static inline int elog_init(void) { return -1; }
@@ -240,6 +247,8 @@ static inline int elog_smbios_write_type15(unsigned long *current,
 	return 0;
 }
 static inline int elog_add_extended_event(u8 type, u32 complement) { return 0; }
+static inline void elog_batch_begin(void) {}
+static inline int elog_batch_end(void) { return 0; }
 #endif
 
 #if CONFIG(ELOG_GSMI)
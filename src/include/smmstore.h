@@ -14,6 +14,7 @@
 #define SMMSTORE_CMD_CLEAR 1
 #define SMMSTORE_CMD_READ 2
 #define SMMSTORE_CMD_APPEND 3
+#define SMMSTORE_CMD_LOOKUP 8
 
 /* Version 2 */
 #define SMMSTORE_CMD_INIT 4
@@ -34,6 +35,13 @@ struct smmstore_params_append {
 	size_t valsize;
 };
 
+struct smmstore_params_lookup {
+	void *key;
+	size_t keysize;
+	void *buf;
+	ssize_t bufsize;
+};
+
 /* Version 2 */
 /*
  * The Version 2 protocol separates the SMMSTORE into 64KiB blocks, each
@@ -105,6 +113,7 @@ uint32_t smmstore_exec(uint8_t command, void *param);
 /* Implementation of Version 1 */
 int smmstore_read_region(void *buf, ssize_t *bufsize);
 int smmstore_append_data(void *key, uint32_t key_sz, void *value, uint32_t value_sz);
+int smmstore_lookup_data(void *key, uint32_t key_sz, void *buf, ssize_t *bufsize);
 int smmstore_clear_region(void);
 
 /* Implementation of Version 2 */
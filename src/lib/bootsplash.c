@@ -6,6 +6,7 @@
 #include <endian.h>
 #include <bootsplash.h>
 #include <stdlib.h>
+#include <timer.h>
 
 #include "jpeg.h"
 
@@ -16,6 +17,7 @@ void set_bootsplash(unsigned char *framebuffer, unsigned int x_resolution,
 	printk(BIOS_INFO, "Setting up bootsplash in %dx%d@%d\n", x_resolution, y_resolution,
 	       fb_resolution);
 	struct jpeg_decdata *decdata;
+	struct stopwatch sw;
 	unsigned char *jpeg = cbfs_map("bootsplash.jpg", NULL);
 	if (!jpeg) {
 		printk(BIOS_ERR, "Could not find bootsplash.jpg\n");
@@ -28,13 +30,15 @@ void set_bootsplash(unsigned char *framebuffer, unsigned int x_resolution,
 	printk(BIOS_DEBUG, "Bootsplash image resolution: %dx%d\n", image_width, image_height);
 
 	decdata = malloc(sizeof(*decdata));
+	stopwatch_init(&sw);
 	int ret = jpeg_decode(jpeg, framebuffer, x_resolution, y_resolution, fb_resolution,
 			      decdata);
+	free(decdata);
 	cbfs_unmap(jpeg);
 	if (ret != 0) {
 		printk(BIOS_ERR, "Bootsplash could not be decoded. jpeg_decode returned %d.\n",
 		       ret);
 		return;
 	}
-	printk(BIOS_INFO, "Bootsplash loaded\n");
+	printk(BIOS_INFO, "Bootsplash loaded in %ld ms\n", stopwatch_duration_msecs(&sw));
 }
@@ -84,9 +84,7 @@ static void scaleidctqtab __P((PREC *, PREC));
 
 static void initcol __P((PREC[][64]));
 
-static void col221111 __P((int *, unsigned char *, int));
-static void col221111_16 __P((int *, unsigned char *, int));
-static void col221111_32 __P((int *, unsigned char *, int));
+static void colconv __P((int *, unsigned char *, int, int, int, int));
 
 /*********************************/
 
@@ -271,6 +269,8 @@ int jpeg_decode(unsigned char *buf, unsigned char *pic,
 {
 	int i, j, m, tac, tdc;
 	int mcusx, mcusy, mx, my;
+	int mcuw, mcuh, nblocks, nyblocks, hv, stride;
+	int imgw, imgh;
 	int max[6];
 
 	if (!decdata || !buf || !pic)
@@ -286,11 +286,9 @@ int jpeg_decode(unsigned char *buf, unsigned char *pic,
 	i = getbyte();
 	if (i != 8)
 		return ERR_NOT_8BIT;
-	if (((getword() + 15) & ~15) != height)
-		return ERR_HEIGHT_MISMATCH;
-	if (((getword() + 15) & ~15) != width)
-		return ERR_WIDTH_MISMATCH;
-	if ((height & 15) || (width & 15))
+	imgh = getword();
+	imgw = getword();
+	if (imgh <= 0 || imgw <= 0)
 		return ERR_BAD_WIDTH_OR_HEIGHT;
 	info.nc = getbyte();
 	if (info.nc > MAXCOMP)
@@ -311,9 +309,9 @@ int jpeg_decode(unsigned char *buf, unsigned char *pic,
 		return ERR_BAD_TABLES;
 	getword();
 	info.ns = getbyte();
-	if (info.ns != 3)
+	if (info.ns != 1 && info.ns != 3)
 		return ERR_NOT_YCBCR_221111;
-	for (i = 0; i < 3; i++) {
+	for (i = 0; i < info.ns; i++) {
 		dscans[i].cid = getbyte();
 		tdc = getbyte();
 		tac = tdc & 15;
@@ -338,67 +336,88 @@ int jpeg_decode(unsigned char *buf, unsigned char *pic,
 	if (i != 0 || j != 63 || m != 0)
 		return ERR_NOT_SEQUENTIAL_DCT;
 
-	if (dscans[0].cid != 1 || dscans[1].cid != 2 || dscans[2].cid != 3)
-		return ERR_NOT_YCBCR_221111;
-
-	if (dscans[0].hv != 0x22 || dscans[1].hv != 0x11
-		|| dscans[2].hv != 0x11)
-		return ERR_NOT_YCBCR_221111;
+	if (info.ns == 1) {
+		/*
+		 * Grayscale. A scan with a single component is not
+		 * interleaved, so every MCU is exactly one block no matter
+		 * what the sampling factors say.
+		 */
+		if (info.nc != 1)
+			return ERR_NOT_YCBCR_221111;
+		dscans[0].hv = 0x11;
+	} else {
+		/*
+		 * YCbCr with full resolution chroma (4:4:4), or chroma
+		 * subsampled horizontally (4:2:2), vertically (4:4:0) or both
+		 * (4:2:0).
+		 */
+		if (dscans[0].cid != 1 || dscans[1].cid != 2
+			|| dscans[2].cid != 3)
+			return ERR_NOT_YCBCR_221111;
+		if (dscans[1].hv != 0x11 || dscans[2].hv != 0x11)
+			return ERR_NOT_YCBCR_221111;
+		if (dscans[0].hv != 0x11 && dscans[0].hv != 0x21
+			&& dscans[0].hv != 0x12 && dscans[0].hv != 0x22)
+			return ERR_NOT_YCBCR_221111;
+	}
 
-	mcusx = width >> 4;
-	mcusy = height >> 4;
+	/* MCU geometry follows the luma sampling factors. */
+	hv = dscans[0].hv;
+	mcuw = (hv >> 4) * 8;
+	mcuh = (hv & 15) * 8;
+	nyblocks = (hv >> 4) * (hv & 15);
+	if (((imgh + mcuh - 1) & ~(mcuh - 1)) != height)
+		return ERR_HEIGHT_MISMATCH;
+	if (((imgw + mcuw - 1) & ~(mcuw - 1)) != width)
+		return ERR_WIDTH_MISMATCH;
+	if (depth != 16 && depth != 24 && depth != 32)
+		return ERR_DEPTH_MISMATCH;
 
+	mcusx = width / mcuw;
+	mcusy = height / mcuh;
+	stride = width * depth / 8;
 
 	idctqtab(quant[dscans[0].tq], decdata->dquant[0]);
-	idctqtab(quant[dscans[1].tq], decdata->dquant[1]);
-	idctqtab(quant[dscans[2].tq], decdata->dquant[2]);
-	initcol(decdata->dquant);
+	if (info.ns == 3) {
+		idctqtab(quant[dscans[1].tq], decdata->dquant[1]);
+		idctqtab(quant[dscans[2].tq], decdata->dquant[2]);
+		initcol(decdata->dquant);
+	}
 	setinput(&glob_in, datap);
 
 	dec_initscans();
 
-	dscans[0].next = 6 - 4;
-	dscans[1].next = 6 - 4 - 1;
-	dscans[2].next = 6 - 4 - 1 - 1;	/* 411 encoding */
+	/* decode_mcus() moves on to the next scan when n hits ->next. */
+	dscans[0].next = info.ns == 3 ? 2 : 0;
+	dscans[1].next = 1;
+	dscans[2].next = 0;
+	nblocks = info.ns == 3 ? nyblocks + 2 : nyblocks;
+
+	/*
+	 * Every MCU is decoded, transformed and color converted straight into
+	 * its place in the output picture, walking the picture row by row.
+	 */
 	for (my = 0; my < mcusy; my++) {
+		unsigned char *row = pic + my * mcuh * stride;
+
 		for (mx = 0; mx < mcusx; mx++) {
 			if (info.dri && !--info.nm)
 				if (dec_checkmarker())
 					return ERR_WRONG_MARKER;
 
-			decode_mcus(&glob_in, decdata->dcts, 6, dscans, max);
-			idct(decdata->dcts, decdata->out, decdata->dquant[0],
-				IFIX(128.5), max[0]);
-			idct(decdata->dcts + 64, decdata->out + 64,
-				decdata->dquant[0], IFIX(128.5), max[1]);
-			idct(decdata->dcts + 128, decdata->out + 128,
-				decdata->dquant[0], IFIX(128.5), max[2]);
-			idct(decdata->dcts + 192, decdata->out + 192,
-				decdata->dquant[0], IFIX(128.5), max[3]);
-			idct(decdata->dcts + 256, decdata->out + 256,
-				decdata->dquant[1], IFIX(0.5), max[4]);
-			idct(decdata->dcts + 320, decdata->out + 320,
-				decdata->dquant[2], IFIX(0.5), max[5]);
-
-			switch (depth) {
-			case 32:
-				col221111_32(decdata->out, pic
-					+ (my * 16 * mcusx + mx) * 16 * 4,
-					mcusx * 16 * 4);
-				break;
-			case 24:
-				col221111(decdata->out, pic
-					+ (my * 16 * mcusx + mx) * 16 * 3,
-					mcusx * 16 * 3);
-				break;
-			case 16:
-				col221111_16(decdata->out, pic
-					+ (my * 16 * mcusx + mx) * (16 * 2),
-					mcusx * (16 * 2));
-				break;
-			default:
-				return ERR_DEPTH_MISMATCH;
+			decode_mcus(&glob_in, decdata->dcts, nblocks, dscans,
+				    max);
+			for (i = 0; i < nblocks; i++) {
+				/* Luma blocks first, then Cb and Cr. */
+				int q = i < nyblocks ? 0 : i - nyblocks + 1;
+
+				idct(decdata->dcts + i * 64,
+				     decdata->out + i * 64, decdata->dquant[q],
+				     q ? IFIX(0.5) : IFIX(128.5), max[i]);
 			}
+
+			colconv(decdata->out, row + mx * mcuw * depth / 8,
+				stride, hv, info.ns == 1, depth);
 		}
 	}
 
@@ -713,6 +732,14 @@ void idct(int *in, int *out, PREC *lquant, PREC off, int max)
 		t3 = in[j] * lquant[j];
 		j = *zig2p++;
 		t6 = in[j] * lquant[j];
+		if (!(t1 | t2 | t3 | t4 | t5 | t6 | t7)) {
+			/* Only DC in this column, which is the common case. */
+			for (j = 0; j < 8; j++)
+				tmpp[j * 8] = t0;
+			tmpp++;
+			t0 = 0;
+			continue;
+		}
 		IDCT;
 		tmpp[0 * 8] = t0;
 		tmpp[1 * 8] = t1;
@@ -848,152 +875,107 @@ static void initcol(PREC q[][64])
 
 #endif
 
-#define PIC(yin, xin, p, xout)			\
-(						\
-	y = outy[(yin) * 8 + xin],		\
-	STORECLAMP(p[(xout) * 3 + 0], y + cr),	\
-	STORECLAMP(p[(xout) * 3 + 1], y - cg),	\
-	STORECLAMP(p[(xout) * 3 + 2], y + cb)	\
+/*
+ * Color convert one MCU of IDCT output into the picture. |hv| holds the luma
+ * sampling factors, which are 1 or 2 in each direction, and chroma is
+ * replicated accordingly. Luma blocks are stored first in |out|, row by row,
+ * followed by one Cb and one Cr block.
+ */
+#define COLCONV(STORE)							\
+	for (y = 0; y < mcuh; y++, pic += stride) {			\
+		outc = out + h * v * 64 + (y >> (v - 1)) * 8;		\
+		dither = dither16[y & 1];				\
+		for (bx = 0; bx < h; bx++, outc += 4) {			\
+			outy = out + ((y >> 3) * h + bx) * 64 + (y & 7) * 8; \
+			p = pic + bx * 8 * (depth / 8);			\
+			for (x = 0; x < 8; x += 2) {			\
+				if (!gray)				\
+					CBCRCG(0, (x >> (h - 1)));	\
+				yv = outy[x];				\
+				STORE(p, x, 0);				\
+				if (!gray && h == 1)			\
+					CBCRCG(0, x + 1);		\
+				yv = outy[x + 1];			\
+				STORE(p, x + 1, 1);			\
+			}						\
+		}							\
+	}
+
+#define STORE_24(p, xout, odd)				\
+(								\
+	STORECLAMP(p[(xout) * 3 + 0], yv + cr),			\
+	STORECLAMP(p[(xout) * 3 + 1], yv - cg),			\
+	STORECLAMP(p[(xout) * 3 + 2], yv + cb)			\
+)
+
+#define STORE_32(p, xout, odd)				\
+(								\
+	STORECLAMP(p[(xout) * 4 + 0], yv + cr),			\
+	STORECLAMP(p[(xout) * 4 + 1], yv - cg),			\
+	STORECLAMP(p[(xout) * 4 + 2], yv + cb),			\
+	p[(xout) * 4 + 3] = 0					\
 )
 
+/* 16 bit output is dithered with a 2x2 ordered pattern. */
 #ifdef __LITTLE_ENDIAN
-#define PIC_16(yin, xin, p, xout, add)				\
+#define STORE_16(p, xout, odd)				\
 (								\
-	y = outy[(yin) * 8 + xin],				\
-	y = ((CLAMP(y + cr + add*2+1) & 0xf8) <<  8) |		\
-		((CLAMP(y - cg + add)     & 0xfc) <<  3) |	\
-		((CLAMP(y + cb + add*2+1))        >>  3),	\
-	p[(xout) * 2 + 0] = y & 0xff,				\
-	p[(xout) * 2 + 1] = y >> 8				\
+	add = dither[odd],					\
+	yv = ((CLAMP(yv + cr + add*2+1) & 0xf8) <<  8) |	\
+		((CLAMP(yv - cg + add)     & 0xfc) <<  3) |	\
+		((CLAMP(yv + cb + add*2+1))        >>  3),	\
+	p[(xout) * 2 + 0] = yv & 0xff,				\
+	p[(xout) * 2 + 1] = yv >> 8				\
 )
 #else
 #ifdef CONFIG_PPC
-#define PIC_16(yin, xin, p, xout, add)				\
+#define STORE_16(p, xout, odd)				\
 (								\
-	y = outy[(yin) * 8 + xin],				\
-	y = ((CLAMP(y + cr + add*2+1) & 0xf8) <<  7) |		\
-		((CLAMP(y - cg + add*2+1) & 0xf8) <<  2) |	\
-		((CLAMP(y + cb + add*2+1))        >>  3),	\
-	p[(xout) * 2 + 0] = y >> 8,				\
-	p[(xout) * 2 + 1] = y & 0xff				\
+	add = dither[odd],					\
+	yv = ((CLAMP(yv + cr + add*2+1) & 0xf8) <<  7) |	\
+		((CLAMP(yv - cg + add*2+1) & 0xf8) <<  2) |	\
+		((CLAMP(yv + cb + add*2+1))        >>  3),	\
+	p[(xout) * 2 + 0] = yv >> 8,				\
+	p[(xout) * 2 + 1] = yv & 0xff				\
 )
 #else
-#define PIC_16(yin, xin, p, xout, add)				\
+#define STORE_16(p, xout, odd)				\
 (								\
-	y = outy[(yin) * 8 + xin],				\
-	y = ((CLAMP(y + cr + add*2+1) & 0xf8) <<  8) |		\
-		((CLAMP(y - cg + add)     & 0xfc) <<  3) |	\
-		((CLAMP(y + cb + add*2+1))        >>  3),	\
-	p[(xout) * 2 + 0] = y >> 8,				\
-	p[(xout) * 2 + 1] = y & 0xff				\
+	add = dither[odd],					\
+	yv = ((CLAMP(yv + cr + add*2+1) & 0xf8) <<  8) |	\
+		((CLAMP(yv - cg + add)     & 0xfc) <<  3) |	\
+		((CLAMP(yv + cb + add*2+1))        >>  3),	\
+	p[(xout) * 2 + 0] = yv >> 8,				\
+	p[(xout) * 2 + 1] = yv & 0xff				\
 )
 #endif
 #endif
 
-#define PIC_32(yin, xin, p, xout)		\
-(						\
-	y = outy[(yin) * 8 + xin],		\
-	STORECLAMP(p[(xout) * 4 + 0], y + cr),	\
-	STORECLAMP(p[(xout) * 4 + 1], y - cg),	\
-	STORECLAMP(p[(xout) * 4 + 2], y + cb),	\
-	p[(xout) * 4 + 3] = 0			\
-)
-
-#define PIC221111(xin)							\
-(									\
-	CBCRCG(0, xin),							\
-	PIC(xin / 4 * 8 + 0, (xin & 3) * 2 + 0, pic0, xin * 2 + 0),	\
-	PIC(xin / 4 * 8 + 0, (xin & 3) * 2 + 1, pic0, xin * 2 + 1),	\
-	PIC(xin / 4 * 8 + 1, (xin & 3) * 2 + 0, pic1, xin * 2 + 0),	\
-	PIC(xin / 4 * 8 + 1, (xin & 3) * 2 + 1, pic1, xin * 2 + 1)	\
-)
-
-#define PIC221111_16(xin)						       \
-(									       \
-	CBCRCG(0, xin),							       \
-	PIC_16(xin / 4 * 8 + 0, (xin & 3) * 2 + 0, pic0, xin * 2 + 0, 3),      \
-	PIC_16(xin / 4 * 8 + 0, (xin & 3) * 2 + 1, pic0, xin * 2 + 1, 0),      \
-	PIC_16(xin / 4 * 8 + 1, (xin & 3) * 2 + 0, pic1, xin * 2 + 0, 1),      \
-	PIC_16(xin / 4 * 8 + 1, (xin & 3) * 2 + 1, pic1, xin * 2 + 1, 2)       \
-)
-
-#define PIC221111_32(xin)						\
-(									\
-	CBCRCG(0, xin),							\
-	PIC_32(xin / 4 * 8 + 0, (xin & 3) * 2 + 0, pic0, xin * 2 + 0),	\
-	PIC_32(xin / 4 * 8 + 0, (xin & 3) * 2 + 1, pic0, xin * 2 + 1),	\
-	PIC_32(xin / 4 * 8 + 1, (xin & 3) * 2 + 0, pic1, xin * 2 + 0),	\
-	PIC_32(xin / 4 * 8 + 1, (xin & 3) * 2 + 1, pic1, xin * 2 + 1)	\
-)
-
-static void col221111(int *out, unsigned char *pic, int width)
-{
-	int i, j, k;
-	unsigned char *pic0, *pic1;
-	int *outy, *outc;
-	int cr, cg, cb, y;
-
-	pic0 = pic;
-	pic1 = pic + width;
-	outy = out;
-	outc = out + 64 * 4;
-	for (i = 2; i > 0; i--) {
-		for (j = 4; j > 0; j--) {
-			for (k = 0; k < 8; k++)
-				PIC221111(k);
-			outc += 8;
-			outy += 16;
-			pic0 += 2 * width;
-			pic1 += 2 * width;
-		}
-		outy += 64 * 2 - 16 * 4;
-	}
-}
-
-static void col221111_16(int *out, unsigned char *pic, int width)
-{
-	int i, j, k;
-	unsigned char *pic0, *pic1;
-	int *outy, *outc;
-	int cr, cg, cb, y;
-
-	pic0 = pic;
-	pic1 = pic + width;
-	outy = out;
-	outc = out + 64 * 4;
-	for (i = 2; i > 0; i--) {
-		for (j = 4; j > 0; j--) {
-			for (k = 0; k < 8; k++)
-				PIC221111_16(k);
-			outc += 8;
-			outy += 16;
-			pic0 += 2 * width;
-			pic1 += 2 * width;
-		}
-		outy += 64 * 2 - 16 * 4;
-	}
-}
+static const unsigned char dither16[2][2] = {
+	{ 3, 0 },
+	{ 1, 2 },
+};
 
-static void col221111_32(int *out, unsigned char *pic, int width)
+static void colconv(int *out, unsigned char *pic, int stride, int hv,
+	int gray, int depth)
 {
-	int i, j, k;
-	unsigned char *pic0, *pic1;
+	const int h = hv >> 4, v = hv & 15;
+	const int mcuh = v * 8;
+	const unsigned char *dither;
+	unsigned char *p;
 	int *outy, *outc;
-	int cr, cg, cb, y;
-
-	pic0 = pic;
-	pic1 = pic + width;
-	outy = out;
-	outc = out + 64 * 4;
-	for (i = 2; i > 0; i--) {
-		for (j = 4; j > 0; j--) {
-			for (k = 0; k < 8; k++)
-				PIC221111_32(k);
-			outc += 8;
-			outy += 16;
-			pic0 += 2 * width;
-			pic1 += 2 * width;
-		}
-		outy += 64 * 2 - 16 * 4;
+	int cr = 0, cg = 0, cb = 0, yv, add;
+	int x, y, bx;
+
+	switch (depth) {
+	case 32:
+		COLCONV(STORE_32);
+		break;
+	case 24:
+		COLCONV(STORE_24);
+		break;
+	case 16:
+		COLCONV(STORE_16);
+		break;
 	}
 }
@@ -27,6 +27,13 @@
  * write and the data write results in blocks being allocated but not
  * entirely written. It's up to the user of the library to sanity check
  * data stored.
+ *
+ * Once an update doesn't fit anymore the region is emptied and the update
+ * is written as the first one. This is done in place one erase block at a
+ * time: blocks already holding the intended contents are left alone and
+ * blocks which only need bits cleared are programmed without an erase.
+ * Data which rarely changes, like memory training results, thus only costs
+ * erasing and programming the blocks that differ from the oldest update.
  */
 
 #define REGF_BLOCK_SHIFT		4
@@ -35,6 +42,10 @@
 #define REGF_UNALLOCATED_BLOCK		0xffff
 #define REGF_UPDATES_PER_METADATA_BLOCK	\
 	(REGF_METADATA_BLOCK_SIZE / sizeof(uint16_t))
+/* Smallest erase granularity of the SPI flash parts in use. */
+#define REGF_ERASE_BLOCK_SIZE		(4 * KiB)
+/* Amount compared and programmed at once, one SPI flash page. */
+#define REGF_REWRITE_CHUNK_SIZE		256
 
 enum {
 	RF_ONLY_METADATA = 0,
@@ -276,11 +287,11 @@ int region_file_data(const struct region_file *f, struct region_device *rdev)
  *   T * A = x * (D * A + M)
  *   x = T * A / (D * A + M)
  */
-static int allocate_metadata(struct region_file *f, size_t data_blks)
+static size_t metadata_blocks_needed(const struct region_file *f,
+				     size_t data_blks)
 {
 	size_t t, m;
 	size_t x, y;
-	uint16_t tot_metadata;
 	const size_t a = REGF_UPDATES_PER_METADATA_BLOCK;
 	const size_t d = data_blks;
 
@@ -292,7 +303,7 @@ static int allocate_metadata(struct region_file *f, size_t data_blks)
 	/* Ensure at least one data update can fit with 1 metadata block
 	 * within the region. */
 	if (d > t - m)
-		return -1;
+		return 0;
 
 	/* Maximize number of updates by aligning up to the number updates in
 	 * a metadata block. May not really be able to achieve the number of
@@ -307,8 +318,18 @@ static int allocate_metadata(struct region_file *f, size_t data_blks)
 	/* Now calculate how many metadata blocks are needed. */
 	y = ALIGN_UP(x, a) / a;
 
+	return m * y;
+}
+
+static int allocate_metadata(struct region_file *f, size_t data_blks)
+{
+	uint16_t tot_metadata;
+
+	tot_metadata = metadata_blocks_needed(f, data_blks);
+	if (tot_metadata == 0)
+		return -1;
+
 	/* Need to commit the metadata allocation. */
-	tot_metadata = m * y;
 	if (rdev_writeat(&f->rdev, &tot_metadata, 0, sizeof(tot_metadata)) < 0)
 		return -1;
 
@@ -391,14 +412,132 @@ static int handle_empty(struct region_file *f, size_t data_blks)
 	return 0;
 }
 
-static int handle_need_to_empty(struct region_file *f)
+/* Contents of the region after emptying it and writing one update. */
+struct rewrite_layout {
+	/* Metadata size and end of the first update, in blocks */
+	uint16_t metadata[2];
+	const struct update_region_file_entry *entries;
+	size_t num_entries;
+};
+
+/* Copy the part of src, placed at src_offset, overlapping with buf. */
+static void copy_overlap(uint8_t *buf, size_t buf_offset, size_t buf_size,
+			 const void *src, size_t src_offset, size_t src_size)
+{
+	size_t start = MAX(buf_offset, src_offset);
+	size_t end = MIN(buf_offset + buf_size, src_offset + src_size);
+
+	if (start < end)
+		memcpy(buf + start - buf_offset,
+		       (const uint8_t *)src + start - src_offset, end - start);
+}
+
+static void rewrite_layout_fill(const struct rewrite_layout *l, uint8_t *buf,
+				size_t offset, size_t size)
+{
+	size_t data_offset = block_to_bytes(l->metadata[0]);
+	size_t i;
+
+	memset(buf, 0xff, size);
+	copy_overlap(buf, offset, size, l->metadata, 0, sizeof(l->metadata));
+
+	for (i = 0; i < l->num_entries; i++) {
+		copy_overlap(buf, offset, size, l->entries[i].data, data_offset,
+			     l->entries[i].size);
+		data_offset += l->entries[i].size;
+	}
+}
+
+static int rewrite_erase_block(struct region_file *f,
+			       const struct rewrite_layout *l,
+			       size_t offset, size_t size)
+{
+	uint8_t old[REGF_REWRITE_CHUNK_SIZE];
+	uint8_t new[REGF_REWRITE_CHUNK_SIZE];
+	bool differs = false;
+	bool need_erase = false;
+	size_t pos, len, i;
+
+	for (pos = 0; pos < size && !need_erase; pos += len) {
+		len = MIN(size - pos, sizeof(old));
+		if (rdev_readat(&f->rdev, old, offset + pos, len) < 0)
+			return -1;
+		rewrite_layout_fill(l, new, offset + pos, len);
+
+		for (i = 0; i < len; i++) {
+			if (old[i] == new[i])
+				continue;
+			differs = true;
+			/* Programming can only clear bits. */
+			if ((old[i] & new[i]) != new[i])
+				need_erase = true;
+		}
+	}
+
+	if (!differs)
+		return 0;
+
+	if (need_erase && rdev_eraseat(&f->rdev, offset, size) < 0)
+		return -1;
+
+	for (pos = 0; pos < size; pos += len) {
+		len = MIN(size - pos, sizeof(old));
+		rewrite_layout_fill(l, new, offset + pos, len);
+
+		/* Skip chunks the flash already holds. */
+		if (need_erase)
+			memset(old, 0xff, len);
+		else if (rdev_readat(&f->rdev, old, offset + pos, len) < 0)
+			return -1;
+		if (!memcmp(old, new, len))
+			continue;
+
+		if (rdev_writeat(&f->rdev, new, offset + pos, len) < 0)
+			return -1;
+	}
+
+	return 0;
+}
+
+static int handle_need_to_empty(struct region_file *f, size_t data_blks,
+				const struct update_region_file_entry *entries,
+				size_t num_entries)
 {
-	if (rdev_eraseat(&f->rdev, 0, region_device_sz(&f->rdev)) < 0) {
-		printk(BIOS_ERR, "REGF empty failed.\n");
+	struct rewrite_layout l = {
+		.entries = entries,
+		.num_entries = num_entries,
+	};
+	size_t size = region_device_sz(&f->rdev);
+	size_t offset;
+
+	l.metadata[0] = metadata_blocks_needed(f, data_blks);
+	if (l.metadata[0] == 0) {
+		printk(BIOS_ERR, "REGF metadata allocation failed: %zd data blocks %zd total blocks\n",
+			data_blks, bytes_to_block(size));
 		return -1;
 	}
+	l.metadata[1] = l.metadata[0] + data_blks;
+
+	/* Go backwards so the metadata describing the update is written
+	 * last. */
+	offset = ALIGN_DOWN(size - 1, REGF_ERASE_BLOCK_SIZE);
+	while (1) {
+		if (rewrite_erase_block(f, &l, offset,
+				MIN(size - offset, REGF_ERASE_BLOCK_SIZE)) < 0) {
+			printk(BIOS_ERR, "REGF empty failed.\n");
+			return -1;
+		}
+		if (offset == 0)
+			break;
+		offset -= REGF_ERASE_BLOCK_SIZE;
+	}
+
+	if (rdev_chain(&f->metadata, &f->rdev, 0, block_to_bytes(l.metadata[0])))
+		return -1;
 
-	f->slot = RF_EMPTY;
+	f->slot = RF_ONLY_METADATA + 1;
+	f->data_blocks[0] = l.metadata[0];
+	f->data_blocks[1] = l.metadata[1];
 
 	return 0;
 }
@@ -446,7 +585,7 @@ int region_file_update_data_arr(struct region_file *f,
 			ret = handle_empty(f, blocks);
 			break;
 		case RF_NEED_TO_EMPTY:
-			ret = handle_need_to_empty(f);
+			ret = handle_need_to_empty(f, blocks, entries, num_entries);
 			break;
 		case RF_FATAL:
 			ret = -1;
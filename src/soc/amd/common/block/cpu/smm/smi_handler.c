@@ -4,6 +4,7 @@
 #include <console/console.h>
 #include <amdblocks/smi.h>
 #include <amdblocks/smm.h>
+#include <cpu/x86/smi_latency.h>
 #include <cpu/x86/smm.h>
 #include <soc/smi.h>
 
@@ -35,6 +36,8 @@ void southbridge_smi_handler(void)
 {
 	const uint16_t smi_src = smi_read16(SMI_REG_POINTER);
 
+	smi_latency_set_source(smi_src);
+
 	if (smi_src & SMI_STATUS_SRC_SCI) {
 		printk(BIOS_WARNING, "Ignoring SCI SMI: %#x\n", smi_read32(SMI_SCI_STATUS));
 
@@ -5,6 +5,7 @@
 #include <device/pci_ops.h>
 #include <console/console.h>
 #include <cpu/x86/cache.h>
+#include <cpu/x86/smi_latency.h>
 #include <cpu/x86/smm.h>
 #include <cpu/intel/em64t100_save_state.h>
 #include <cpu/intel/em64t101_save_state.h>
@@ -474,6 +475,8 @@ void southbridge_smi_handler(void)
 	if (pmc_read_pm1_control() & SCI_EN)
 		smi_sts &= ~(1 << PM1_STS_BIT | 1 << GPE0_STS_BIT);
 
+	smi_latency_set_source(smi_sts);
+
 	if (!smi_sts)
 		return;
 
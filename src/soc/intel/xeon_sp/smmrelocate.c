@@ -100,12 +100,46 @@ static void update_save_state(int cpu, uintptr_t curr_smbase,
 	printk(BIOS_DEBUG, "New SMBASE=0x%08x IEDBASE=0x%08x\n apic_id=0x%x\n",
 		smbase, iedbase, apic_id);
 
+	/*
+	 * If smm_save_state_in_msrs is non-zero the CPUs are relocating in
+	 * parallel and each CPU's save state lives in its MSR space.
+	 * Otherwise they relocate serially, all using the save state at the
+	 * default SMBASE.
+	 */
+	if (relo_params->smm_save_state_in_msrs) {
+		msr_t smbase_msr = { .lo = smbase, .hi = 0 };
+		/* IEDBASE is in bits 63:32 of its MSR. */
+		msr_t iedbase_msr = { .lo = 0, .hi = iedbase };
+
+		wrmsr(SMBASE_MSR, smbase_msr);
+		wrmsr(IEDBASE_MSR, iedbase_msr);
+		return;
+	}
+
 	save_state = (void *)(curr_smbase + SMM_DEFAULT_SIZE - sizeof(*save_state));
 
 	save_state->smbase = smbase;
 	save_state->iedbase = iedbase;
 }
 
+/* Returns 1 if SMM MSR save state was set. */
+static int bsp_setup_msr_save_state(struct smm_relocation_params *relo_params)
+{
+	msr_t smm_mca_cap;
+
+	smm_mca_cap = rdmsr(SMM_MCA_CAP_MSR);
+	if (smm_mca_cap.hi & SMM_CPU_SVRSTR_MASK) {
+		msr_t smm_feature_control;
+
+		smm_feature_control = rdmsr(SMM_FEATURE_CONTROL_MSR);
+		smm_feature_control.hi = 0;
+		smm_feature_control.lo |= SMM_CPU_SAVE_EN;
+		wrmsr(SMM_FEATURE_CONTROL_MSR, smm_feature_control);
+		relo_params->smm_save_state_in_msrs = 1;
+	}
+	return relo_params->smm_save_state_in_msrs;
+}
+
 /*
  * The relocation work is actually performed in SMM context, but the code
  * resides in the ramstage module. This occurs by trampolining from the default
@@ -119,6 +153,25 @@ void smm_relocation_handler(int cpu, uintptr_t curr_smbase,
 
 	printk(BIOS_DEBUG, "%s : CPU %d\n", __func__, cpu);
 
+	/*
+	 * With many sockets relocating one CPU after the other takes a while.
+	 * If the CPUs support saving state in MSRs, the BSP enables it on its
+	 * first pass so that the APs can relocate in parallel, and disables it
+	 * again on its second pass so that the real SMM handler can access the
+	 * other CPUs' save state.
+	 */
+	if (cpu == 0) {
+		if (relo_params->smm_save_state_in_msrs) {
+			msr_t smm_feature_control;
+
+			smm_feature_control = rdmsr(SMM_FEATURE_CONTROL_MSR);
+			smm_feature_control.lo &= ~SMM_CPU_SAVE_EN;
+			wrmsr(SMM_FEATURE_CONTROL_MSR, smm_feature_control);
+		} else if (bsp_setup_msr_save_state(relo_params)) {
+			return;
+		}
+	}
+
 	/* Make appropriate changes to the save state map. */
 	update_save_state(cpu, curr_smbase, staggered_smbase, relo_params);
 
@@ -127,3 +180,30 @@ void smm_relocation_handler(int cpu, uintptr_t curr_smbase,
 	if (mtrr_cap.lo & SMRR_SUPPORTED)
 		write_smrr(relo_params);
 }
+
+void smm_initialize(void)
+{
+	/* Clear the SMM state in the southbridge. */
+	smm_southbridge_clear_state();
+
+	/*
+	 * Run the relocation handler on the BSP to check and set up parallel
+	 * SMM relocation.
+	 */
+	smm_initiate_relocation();
+
+	if (smm_reloc_params.smm_save_state_in_msrs)
+		printk(BIOS_DEBUG, "Doing parallel SMM relocation.\n");
+}
+
+void smm_relocate(void)
+{
+	/*
+	 * With parallel relocation the BSP runs the relocation handler a
+	 * second time to do the final move. APs always need to run it once.
+	 */
+	if (smm_reloc_params.smm_save_state_in_msrs)
+		smm_initiate_relocation_parallel();
+	else if (!boot_cpu())
+		smm_initiate_relocation();
+}
@@ -0,0 +1,175 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <stdlib.h>
+#include <string.h>
+#include <types.h>
+#include <tests/test.h>
+#include <acpi/acpigen.h>
+
+#define ACPIGEN_CPU_TEST_BUFFER_SZ (1 * MiB)
+#define CORES_PER_PACKAGE 8
+
+struct cpu_test_buffers {
+	char *direct;
+	char *template;
+};
+
+static int setup_acpigen_cpu(void **state)
+{
+	struct cpu_test_buffers *bufs = malloc(sizeof(*bufs));
+
+	if (bufs == NULL)
+		return -1;
+
+	bufs->direct = calloc(1, ACPIGEN_CPU_TEST_BUFFER_SZ);
+	bufs->template = calloc(1, ACPIGEN_CPU_TEST_BUFFER_SZ);
+	if (bufs->direct == NULL || bufs->template == NULL) {
+		free(bufs->direct);
+		free(bufs->template);
+		free(bufs);
+		return -1;
+	}
+
+	*state = bufs;
+	return 0;
+}
+
+static int teardown_acpigen_cpu(void **state)
+{
+	struct cpu_test_buffers *bufs = *state;
+
+	free(bufs->direct);
+	free(bufs->template);
+	free(bufs);
+	return 0;
+}
+
+/* Processor body similar to what the Intel CPU drivers generate */
+static void write_cpu_body(int core, int package)
+{
+	acpi_cstate_t cstates[] = {
+		{ .ctype = 1, .latency = 1, .power = 1000,
+		  .resource = { .space_id = ACPI_ADDRESS_SPACE_FIXED,
+				.bit_width = 1, .bit_offset = 2 } },
+		{ .ctype = 2, .latency = 59, .power = 900,
+		  .resource = { .space_id = ACPI_ADDRESS_SPACE_FIXED,
+				.bit_width = 1, .bit_offset = 2,
+				.addrl = 0x10 } },
+		{ .ctype = 3, .latency = 80, .power = 800,
+		  .resource = { .space_id = ACPI_ADDRESS_SPACE_FIXED,
+				.bit_width = 1, .bit_offset = 2,
+				.addrl = 0x20 } },
+	};
+	acpi_tstate_t tstates[8];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(tstates); i++) {
+		tstates[i] = (acpi_tstate_t){ 100 - i * 12, 1000 - i * 125, 0,
+					      0x1f - i, 0 };
+	}
+
+	acpigen_write_empty_PCT();
+	acpigen_write_PPC_NVS();
+	acpigen_write_PSD_package(core, 1, HW_ALL);
+
+	acpigen_write_name("_PSS");
+	acpigen_write_package(16);
+	for (i = 0; i < 16; i++)
+		acpigen_write_PSS_package(3400 - i * 100, 35000 - i * 1500,
+					  10, 10, (34 - i) << 8, (34 - i) << 8);
+	acpigen_pop_len();
+
+	acpigen_write_CST_package(cstates, ARRAY_SIZE(cstates));
+
+	acpigen_write_TSD_package(package, CORES_PER_PACKAGE, SW_ALL);
+	acpigen_write_empty_PTC();
+	acpigen_write_TPC("\\TLVL");
+	acpigen_write_TSS_package(ARRAY_SIZE(tstates), tstates);
+}
+
+static size_t generate_direct(char *buf, int cpus)
+{
+	int i;
+
+	acpigen_set_current(buf);
+	for (i = 0; i < cpus; i++) {
+		acpigen_write_processor(i, 0, 0);
+		write_cpu_body(i % CORES_PER_PACKAGE, i / CORES_PER_PACKAGE);
+		acpigen_pop_len();
+	}
+
+	return acpigen_get_current() - buf;
+}
+
+static size_t generate_template(char *buf, int cpus)
+{
+	struct acpigen_cpu_template tmpl = { 0 };
+	int i;
+
+	acpigen_set_current(buf);
+	for (i = 0; i < cpus; i++) {
+		if (!acpigen_write_processor_copy(&tmpl, i, i % CORES_PER_PACKAGE,
+						  i / CORES_PER_PACKAGE))
+			continue;
+
+		acpigen_write_processor_template(&tmpl, i, 0, 0);
+		write_cpu_body(i % CORES_PER_PACKAGE, i / CORES_PER_PACKAGE);
+		acpigen_write_processor_template_end();
+	}
+
+	return acpigen_get_current() - buf;
+}
+
+static void test_acpigen_cpu(void **state, int cpus)
+{
+	struct cpu_test_buffers *bufs = *state;
+	size_t direct_size, template_size;
+
+	direct_size = generate_direct(bufs->direct, cpus);
+	template_size = generate_template(bufs->template, cpus);
+
+	assert_int_equal(direct_size, template_size);
+	assert_memory_equal(bufs->direct, bufs->template, direct_size);
+}
+
+static void test_acpigen_cpu_8(void **state)
+{
+	test_acpigen_cpu(state, 8);
+}
+
+static void test_acpigen_cpu_64(void **state)
+{
+	test_acpigen_cpu(state, 64);
+}
+
+/* ProcID is a byte, so this also covers the wrap-around at 256. */
+static void test_acpigen_cpu_512(void **state)
+{
+	test_acpigen_cpu(state, 512);
+}
+
+static void test_acpigen_cpu_no_template(void **state)
+{
+	struct cpu_test_buffers *bufs = *state;
+	struct acpigen_cpu_template tmpl = { 0 };
+
+	acpigen_set_current(bufs->template);
+	assert_int_equal(-1, acpigen_write_processor_copy(&tmpl, 1, 0, 0));
+	assert_ptr_equal(bufs->template, acpigen_get_current());
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(test_acpigen_cpu_no_template,
+						setup_acpigen_cpu, teardown_acpigen_cpu),
+		cmocka_unit_test_setup_teardown(test_acpigen_cpu_8,
+						setup_acpigen_cpu, teardown_acpigen_cpu),
+		cmocka_unit_test_setup_teardown(test_acpigen_cpu_64,
+						setup_acpigen_cpu, teardown_acpigen_cpu),
+		cmocka_unit_test_setup_teardown(test_acpigen_cpu_512,
+						setup_acpigen_cpu, teardown_acpigen_cpu),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
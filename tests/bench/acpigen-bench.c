@@ -0,0 +1,202 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <acpi/acpigen.h>
+#include <stdlib.h>
+#include <tests/bench.h>
+#include <tests/test.h>
+#include <types.h>
+
+#define ACPIGEN_BENCH_BUFFER_SZ	(1 * MiB)
+#define ACPIGEN_BENCH_DEVICES	32
+#define ACPIGEN_BENCH_CPUS	16
+#define ACPIGEN_BENCH_CORES	8	/* per package */
+
+static int setup_acpigen(void **state)
+{
+	void *buffer = malloc(ACPIGEN_BENCH_BUFFER_SZ);
+
+	if (buffer == NULL)
+		return -1;
+
+	*state = buffer;
+	return 0;
+}
+
+static int teardown_acpigen(void **state)
+{
+	free(*state);
+	return 0;
+}
+
+/* Device objects like the ones the PCI and I2C drivers add to the SSDT */
+static void write_devices(void)
+{
+	char name[5];
+	int i;
+
+	acpigen_write_scope("\\_SB.PCI0");
+	for (i = 0; i < ACPIGEN_BENCH_DEVICES; i++) {
+		snprintf(name, sizeof(name), "D%03d", i);
+		acpigen_write_device(name);
+		acpigen_write_ADR(i << 16);
+		acpigen_write_name_string("_HID", "PNP0C50");
+		acpigen_write_name_integer("_UID", i);
+		acpigen_write_STA(0xf);
+
+		acpigen_write_name("_CRS");
+		acpigen_write_resourcetemplate_header();
+		acpigen_write_mem32fixed(1, 0xfe000000 + i * 0x1000, 0x1000);
+		acpigen_write_io16(0x400 + i * 8, 0x400 + i * 8, 1, 8, 1);
+		acpigen_write_irq(1 << (i % 16));
+		acpigen_write_resourcetemplate_footer();
+
+		acpigen_write_method("_DSM", 4);
+		acpigen_write_if_lequal_op_int(ARG2_OP, 0);
+		acpigen_write_return_integer(0x3);
+		acpigen_write_else();
+		acpigen_write_return_integer(0);
+		acpigen_pop_len();	/* Else */
+		acpigen_pop_len();	/* Method */
+
+		acpigen_write_device_end();
+	}
+	acpigen_pop_len();	/* Scope */
+}
+
+/* Processor objects with P-state tables */
+static void write_cpus(void)
+{
+	int i, j;
+
+	for (i = 0; i < ACPIGEN_BENCH_CPUS; i++) {
+		acpigen_write_processor(i, 0, 0);
+		acpigen_write_PPC_NVS();
+		acpigen_write_name("_PSS");
+		acpigen_write_package(16);
+		for (j = 0; j < 16; j++)
+			acpigen_write_PSS_package(3400 - j * 100, 35000 - j * 1500, 10, 10,
+						  (34 - j) << 8, (34 - j) << 8);
+		acpigen_pop_len();	/* Package */
+		acpigen_pop_len();	/* Processor */
+	}
+}
+
+/* Processor body similar to what the Intel CPU drivers generate */
+static void write_cpu_body(int core, int package)
+{
+	acpi_cstate_t cstates[] = {
+		{ .ctype = 1, .latency = 1, .power = 1000,
+		  .resource = { .space_id = ACPI_ADDRESS_SPACE_FIXED,
+				.bit_width = 1, .bit_offset = 2 } },
+		{ .ctype = 2, .latency = 59, .power = 900,
+		  .resource = { .space_id = ACPI_ADDRESS_SPACE_FIXED,
+				.bit_width = 1, .bit_offset = 2,
+				.addrl = 0x10 } },
+		{ .ctype = 3, .latency = 80, .power = 800,
+		  .resource = { .space_id = ACPI_ADDRESS_SPACE_FIXED,
+				.bit_width = 1, .bit_offset = 2,
+				.addrl = 0x20 } },
+	};
+	acpi_tstate_t tstates[8];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(tstates); i++) {
+		tstates[i] = (acpi_tstate_t){ 100 - i * 12, 1000 - i * 125, 0,
+					      0x1f - i, 0 };
+	}
+
+	acpigen_write_empty_PCT();
+	acpigen_write_PPC_NVS();
+	acpigen_write_PSD_package(core, 1, HW_ALL);
+
+	acpigen_write_name("_PSS");
+	acpigen_write_package(16);
+	for (i = 0; i < 16; i++)
+		acpigen_write_PSS_package(3400 - i * 100, 35000 - i * 1500,
+					  10, 10, (34 - i) << 8, (34 - i) << 8);
+	acpigen_pop_len();	/* Package */
+
+	acpigen_write_CST_package(cstates, ARRAY_SIZE(cstates));
+
+	acpigen_write_TSD_package(package, ACPIGEN_BENCH_CORES, SW_ALL);
+	acpigen_write_empty_PTC();
+	acpigen_write_TPC("\\TLVL");
+	acpigen_write_TSS_package(ARRAY_SIZE(tstates), tstates);
+}
+
+/* Full processor objects, generated one by one */
+static void write_cpus_direct(void)
+{
+	int i;
+
+	for (i = 0; i < ACPIGEN_BENCH_CPUS; i++) {
+		acpigen_write_processor(i, 0, 0);
+		write_cpu_body(i % ACPIGEN_BENCH_CORES, i / ACPIGEN_BENCH_CORES);
+		acpigen_pop_len();	/* Processor */
+	}
+}
+
+/* The same objects, copied from the first one of each core where possible */
+static void write_cpus_template(void)
+{
+	struct acpigen_cpu_template tmpl = { 0 };
+	int i;
+
+	for (i = 0; i < ACPIGEN_BENCH_CPUS; i++) {
+		if (!acpigen_write_processor_copy(&tmpl, i, i % ACPIGEN_BENCH_CORES,
+						  i / ACPIGEN_BENCH_CORES))
+			continue;
+
+		acpigen_write_processor_template(&tmpl, i, 0, 0);
+		write_cpu_body(i % ACPIGEN_BENCH_CORES, i / ACPIGEN_BENCH_CORES);
+		acpigen_write_processor_template_end();
+	}
+}
+
+static void bench_acpigen(struct bench_state *b, void (*write)(void))
+{
+	char *buffer = b->state;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++) {
+		acpigen_set_current(buffer);
+		write();
+	}
+
+	bench_set_bytes(b, acpigen_get_current() - buffer);
+}
+
+static void bench_acpigen_devices(struct bench_state *b)
+{
+	bench_acpigen(b, write_devices);
+}
+
+static void bench_acpigen_cpus(struct bench_state *b)
+{
+	bench_acpigen(b, write_cpus);
+}
+
+static void bench_acpigen_cpus_direct(struct bench_state *b)
+{
+	bench_acpigen(b, write_cpus_direct);
+}
+
+static void bench_acpigen_cpus_template(struct bench_state *b)
+{
+	bench_acpigen(b, write_cpus_template);
+}
+
+int main(int argc, char *argv[])
+{
+	const struct bench benches[] = {
+		bench_unit_setup_teardown(bench_acpigen_devices, setup_acpigen,
+					  teardown_acpigen),
+		bench_unit_setup_teardown(bench_acpigen_cpus, setup_acpigen, teardown_acpigen),
+		bench_unit_setup_teardown(bench_acpigen_cpus_direct, setup_acpigen,
+					  teardown_acpigen),
+		bench_unit_setup_teardown(bench_acpigen_cpus_template, setup_acpigen,
+					  teardown_acpigen),
+	};
+
+	return bench_run_group(benches, argc, argv);
+}
@@ -0,0 +1,173 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <commonlib/helpers.h>
+#include <string.h>
+#include <time.h>
+#include <tests/bench.h>
+#include <tests/test.h>
+
+#define BENCH_DEFAULT_TIME_MS	1000
+#define BENCH_MAX_N		1000000000ULL
+
+/*
+ * Benchmarks are linked with --wrap for the allocation functions, so the calls made by the
+ * code under test end up here.
+ */
+static uint64_t alloc_count;
+static uint64_t alloc_bytes;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nitems, size_t size);
+void *__real_memalign(size_t boundary, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+	alloc_count++;
+	alloc_bytes += size;
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nitems, size_t size)
+{
+	alloc_count++;
+	alloc_bytes += nitems * size;
+	return __real_calloc(nitems, size);
+}
+
+void *__wrap_memalign(size_t boundary, size_t size)
+{
+	alloc_count++;
+	alloc_bytes += size;
+	return __real_memalign(boundary, size);
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void bench_set_bytes(struct bench_state *b, size_t bytes)
+{
+	b->bytes = bytes;
+}
+
+void bench_start_timer(struct bench_state *b)
+{
+	if (b->running)
+		return;
+
+	b->start_ns = now_ns();
+	b->start_allocs = alloc_count;
+	b->start_alloc_bytes = alloc_bytes;
+	b->running = true;
+}
+
+void bench_stop_timer(struct bench_state *b)
+{
+	if (!b->running)
+		return;
+
+	b->elapsed_ns += now_ns() - b->start_ns;
+	b->allocs += alloc_count - b->start_allocs;
+	b->alloc_bytes += alloc_bytes - b->start_alloc_bytes;
+	b->running = false;
+}
+
+void bench_reset_timer(struct bench_state *b)
+{
+	if (b->running) {
+		b->start_ns = now_ns();
+		b->start_allocs = alloc_count;
+		b->start_alloc_bytes = alloc_bytes;
+	}
+	b->elapsed_ns = 0;
+	b->allocs = 0;
+	b->alloc_bytes = 0;
+}
+
+static void bench_run_n(const struct bench *bench, struct bench_state *b, uint64_t n)
+{
+	b->n = n;
+	b->bytes = 0;
+	b->running = false;
+	bench_reset_timer(b);
+	bench_start_timer(b);
+	bench->fn(b);
+	bench_stop_timer(b);
+}
+
+static uint64_t bench_parse_time_ms(int argc, char *argv[])
+{
+	uint64_t ms = 0;
+	const char *p;
+
+	if (argc < 2)
+		return BENCH_DEFAULT_TIME_MS;
+
+	for (p = argv[1]; *p >= '0' && *p <= '9'; p++)
+		ms = ms * 10 + *p - '0';
+
+	return ms ? ms : BENCH_DEFAULT_TIME_MS;
+}
+
+static int bench_run(const struct bench *bench, uint64_t min_ns)
+{
+	struct bench_state b = { 0 };
+	const char *name = bench->name;
+	uint64_t n = 1;
+
+	if (bench->setup && bench->setup(&b.state)) {
+		print_message("FAIL: setup of %s\n", bench->name);
+		return -1;
+	}
+
+	/* Grow n until a run takes min_ns, like the Go benchmark runner does. */
+	bench_run_n(bench, &b, n);
+	while (b.elapsed_ns < min_ns && n < BENCH_MAX_N) {
+		const uint64_t prev = n;
+
+		/* Aim 20% above the target and grow by at most 100x per round. */
+		n = b.elapsed_ns ? min_ns * 6 / 5 * prev / b.elapsed_ns : prev * 100;
+		n = MIN(n, prev * 100);
+		n = MAX(n, prev + 1);
+		n = MIN(n, BENCH_MAX_N);
+		bench_run_n(bench, &b, n);
+	}
+
+	if (bench->teardown && bench->teardown(&b.state)) {
+		print_message("FAIL: teardown of %s\n", bench->name);
+		return -1;
+	}
+
+	if (!strncmp(name, "bench_", 6))
+		name += 6;
+
+	print_message("Benchmark_%s\t%10llu\t%12.1f ns/op", name, (unsigned long long)n,
+		      (double)b.elapsed_ns / n);
+	if (b.bytes && b.elapsed_ns)
+		print_message("\t%10.2f MB/s", (double)b.bytes * n * 1000 / b.elapsed_ns);
+	print_message("\t%8llu B/op\t%6llu allocs/op\n",
+		      (unsigned long long)(b.alloc_bytes / n),
+		      (unsigned long long)(b.allocs / n));
+
+	return 0;
+}
+
+int _bench_run_group(const char *group, const struct bench *benches, size_t count,
+		     int argc, char *argv[])
+{
+	const uint64_t min_ns = bench_parse_time_ms(argc, argv) * 1000000;
+	int ret = 0;
+	size_t i;
+
+	print_message("pkg: %s\n", group);
+	for (i = 0; i < count; i++) {
+		if (bench_run(&benches[i], min_ns))
+			ret = 1;
+	}
+
+	return ret;
+}
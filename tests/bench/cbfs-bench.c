@@ -0,0 +1,181 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <commonlib/bsd/cbfs_private.h>
+#include <commonlib/region.h>
+#include <endian.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tests/bench.h>
+#include <tests/test.h>
+
+#define CBFS_BENCH_SIZE		(512 * KiB)
+#define CBFS_BENCH_MCACHE_SIZE	(8 * KiB)
+
+/* Roughly the contents of an x86 Chromebook CBFS */
+static const char *const cbfs_bench_names[] = {
+	"cbfs master header", "fallback/romstage", "cpu_microcode_blob.bin",
+	"intel_fit", "fspm.bin", "fsps.bin", "fallback/ramstage", "config",
+	"revision", "build_info", "fallback/dsdt.aml", "fallback/postcar",
+	"cmos_layout.bin", "cmos_defaults", "vbt.bin", "logo.bmp", "spd.bin",
+	"fallback/payload", "ecrw", "ecrw.hash", "pdrw", "pdrw.hash", "oemmanifest.bin",
+	"locales", "locale_en.bin", "locale_de.bin", "locale_fr.bin", "font.bin",
+	"vbgfx.bin", "etc/ps2-keyboard-spinup", "etc/sercon-port", "img/nvramcui",
+	"img/memtest", "img/coreinfo", "payload_config", "payload_revision",
+	"bootsplash.jpg", "sign_of_life_wait.bin", "ucode_blob_a.bin", "ucode_blob_b.bin",
+};
+
+struct cbfs_bench {
+	uint8_t *image;
+	struct region_device rdev;
+	void *mcache;
+	size_t mcache_size;
+};
+
+static size_t add_file(uint8_t *image, size_t offset, const char *name, uint32_t type,
+		       size_t data_size)
+{
+	struct cbfs_file *file = (struct cbfs_file *)(image + offset);
+	const size_t data_offset = ALIGN_UP(sizeof(*file) + strlen(name) + 1, 16);
+
+	memset(file, 0, data_offset);
+	memcpy(file->magic, CBFS_FILE_MAGIC, sizeof(file->magic));
+	file->len = htobe32(data_size);
+	file->type = htobe32(type);
+	file->offset = htobe32(data_offset);
+	strcpy(file->filename, name);
+	memset(image + offset + data_offset, 0xa5, data_size);
+
+	return ALIGN_UP(offset + data_offset + data_size, CBFS_ALIGNMENT);
+}
+
+static int setup_cbfs(void **state)
+{
+	struct cbfs_bench *cb = calloc(1, sizeof(*cb));
+	size_t offset = 0;
+	int i;
+
+	if (cb == NULL)
+		return -1;
+
+	cb->image = malloc(CBFS_BENCH_SIZE);
+	cb->mcache = malloc(CBFS_BENCH_MCACHE_SIZE);
+	if (cb->image == NULL || cb->mcache == NULL)
+		return -1;
+
+	memset(cb->image, 0xff, CBFS_BENCH_SIZE);
+	for (i = 0; i < ARRAY_SIZE(cbfs_bench_names); i++)
+		offset = add_file(cb->image, offset, cbfs_bench_names[i], CBFS_TYPE_RAW,
+				  64 + (i * 1237) % 8192);
+
+	/* The free space is covered by an empty file, like cbfstool does it. */
+	add_file(cb->image, offset, "", CBFS_TYPE_NULL,
+		 CBFS_BENCH_SIZE - offset - sizeof(struct cbfs_file) - 16);
+
+	if (rdev_chain_mem(&cb->rdev, cb->image, CBFS_BENCH_SIZE))
+		return -1;
+
+	if (cbfs_mcache_build(&cb->rdev, cb->mcache, CBFS_BENCH_MCACHE_SIZE, NULL))
+		return -1;
+	cb->mcache_size = cbfs_mcache_real_size(cb->mcache, CBFS_BENCH_MCACHE_SIZE);
+
+	*state = cb;
+	return 0;
+}
+
+static int teardown_cbfs(void **state)
+{
+	struct cbfs_bench *cb = *state;
+
+	free(cb->mcache);
+	free(cb->image);
+	free(cb);
+	return 0;
+}
+
+static cb_err_t count_walker(cbfs_dev_t dev, size_t offset, const union cbfs_mdata *mdata,
+			     size_t already_read, void *arg)
+{
+	size_t *count = arg;
+
+	(*count)++;
+	return CB_CBFS_NOT_FOUND;
+}
+
+static void bench_cbfs_walk(struct bench_state *b)
+{
+	struct cbfs_bench *cb = b->state;
+	size_t count;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++) {
+		count = 0;
+		cbfs_walk(&cb->rdev, count_walker, &count, NULL, 0);
+		bench_keep(count);
+	}
+}
+
+static void bench_cbfs_lookup(struct bench_state *b)
+{
+	struct cbfs_bench *cb = b->state;
+	const char *name = cbfs_bench_names[ARRAY_SIZE(cbfs_bench_names) - 1];
+	union cbfs_mdata mdata;
+	size_t data_offset;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++)
+		bench_keep(cbfs_lookup(&cb->rdev, name, &mdata, &data_offset, NULL));
+}
+
+static void bench_cbfs_mcache_build(struct bench_state *b)
+{
+	struct cbfs_bench *cb = b->state;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++)
+		bench_keep(cbfs_mcache_build(&cb->rdev, cb->mcache, CBFS_BENCH_MCACHE_SIZE,
+					     NULL));
+}
+
+static void bench_cbfs_mcache_lookup(struct bench_state *b, const char *name)
+{
+	struct cbfs_bench *cb = b->state;
+	union cbfs_mdata mdata;
+	size_t data_offset;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++)
+		bench_keep(cbfs_mcache_lookup(cb->mcache, cb->mcache_size, name, &mdata,
+					      &data_offset));
+}
+
+static void bench_cbfs_mcache_lookup_first(struct bench_state *b)
+{
+	bench_cbfs_mcache_lookup(b, cbfs_bench_names[1]);
+}
+
+static void bench_cbfs_mcache_lookup_last(struct bench_state *b)
+{
+	bench_cbfs_mcache_lookup(b, cbfs_bench_names[ARRAY_SIZE(cbfs_bench_names) - 1]);
+}
+
+static void bench_cbfs_mcache_lookup_missing(struct bench_state *b)
+{
+	bench_cbfs_mcache_lookup(b, "fallback/missing");
+}
+
+int main(int argc, char *argv[])
+{
+	const struct bench benches[] = {
+		bench_unit_setup_teardown(bench_cbfs_walk, setup_cbfs, teardown_cbfs),
+		bench_unit_setup_teardown(bench_cbfs_lookup, setup_cbfs, teardown_cbfs),
+		bench_unit_setup_teardown(bench_cbfs_mcache_build, setup_cbfs, teardown_cbfs),
+		bench_unit_setup_teardown(bench_cbfs_mcache_lookup_first, setup_cbfs,
+					  teardown_cbfs),
+		bench_unit_setup_teardown(bench_cbfs_mcache_lookup_last, setup_cbfs,
+					  teardown_cbfs),
+		bench_unit_setup_teardown(bench_cbfs_mcache_lookup_missing, setup_cbfs,
+					  teardown_cbfs),
+	};
+
+	return bench_run_group(benches, argc, argv);
+}
@@ -0,0 +1,84 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <commonlib/bsd/compression.h>
+#include <lib.h>
+#include <stdlib.h>
+#include <tests/bench.h>
+#include <tests/bench/compression_data.h>
+#include <tests/test.h>
+
+static uint32_t fnv1a(const uint8_t *data, size_t size)
+{
+	uint32_t hash = 0x811c9dc5;
+
+	while (size--) {
+		hash ^= *data++;
+		hash *= 0x01000193;
+	}
+
+	return hash;
+}
+
+static int setup_compression(void **state)
+{
+	uint8_t *buf = malloc(COMPRESSION_DATA_SIZE);
+
+	if (buf == NULL)
+		return -1;
+
+	/* Make sure both decompressors produce the reference data before timing them. */
+	if (ulz4fn(compression_data_lz4, sizeof(compression_data_lz4), buf,
+		   COMPRESSION_DATA_SIZE) != COMPRESSION_DATA_SIZE ||
+	    fnv1a(buf, COMPRESSION_DATA_SIZE) != COMPRESSION_DATA_FNV1A)
+		goto error;
+
+	if (ulzman(compression_data_lzma, sizeof(compression_data_lzma), buf,
+		   COMPRESSION_DATA_SIZE) != COMPRESSION_DATA_SIZE ||
+	    fnv1a(buf, COMPRESSION_DATA_SIZE) != COMPRESSION_DATA_FNV1A)
+		goto error;
+
+	*state = buf;
+	return 0;
+
+error:
+	free(buf);
+	return -1;
+}
+
+static int teardown_compression(void **state)
+{
+	free(*state);
+	return 0;
+}
+
+static void bench_ulz4fn(struct bench_state *b)
+{
+	uint64_t i;
+
+	bench_set_bytes(b, COMPRESSION_DATA_SIZE);
+	for (i = 0; i < b->n; i++)
+		bench_keep(ulz4fn(compression_data_lz4, sizeof(compression_data_lz4), b->state,
+				  COMPRESSION_DATA_SIZE));
+}
+
+static void bench_ulzman(struct bench_state *b)
+{
+	uint64_t i;
+
+	bench_set_bytes(b, COMPRESSION_DATA_SIZE);
+	for (i = 0; i < b->n; i++)
+		bench_keep(ulzman(compression_data_lzma, sizeof(compression_data_lzma),
+				  b->state, COMPRESSION_DATA_SIZE));
+}
+
+int main(int argc, char *argv[])
+{
+	const struct bench benches[] = {
+		bench_unit_setup_teardown(bench_ulz4fn, setup_compression,
+					  teardown_compression),
+		bench_unit_setup_teardown(bench_ulzman, setup_compression,
+					  teardown_compression),
+	};
+
+	return bench_run_group(benches, argc, argv);
+}
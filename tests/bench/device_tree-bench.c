@@ -0,0 +1,228 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <device_tree.h>
+#include <endian.h>
+#include <halt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tests/bench.h>
+#include <tests/test.h>
+
+#define DT_SOC_DEVICES	48
+#define DT_CPUS		8
+
+/* xmalloc() halts when out of memory */
+void halt(void)
+{
+	__builtin_trap();
+}
+
+struct dt_bench {
+	struct device_tree *tree;
+	void *blob;
+	size_t blob_size;
+	char names[DT_SOC_DEVICES + DT_CPUS][32];
+};
+
+static struct device_tree_node *add_node(struct device_tree_node *parent, const char *name)
+{
+	struct device_tree_node *node = calloc(1, sizeof(*node));
+
+	node->name = name;
+	list_insert_after(&node->list_node, &parent->children);
+	return node;
+}
+
+/* Header, empty reserve map and an empty root node */
+static void *empty_fdt(void)
+{
+	const uint32_t structure[] = {
+		htobe32(FDT_TOKEN_BEGIN_NODE), 0, htobe32(FDT_TOKEN_END_NODE),
+		htobe32(FDT_TOKEN_END),
+	};
+	const size_t reserve_offset = sizeof(struct fdt_header);
+	const size_t structure_offset = reserve_offset + 2 * sizeof(uint64_t);
+	const size_t size = structure_offset + sizeof(structure);
+	struct fdt_header *header = calloc(1, size);
+
+	header->magic = htobe32(FDT_HEADER_MAGIC);
+	header->totalsize = htobe32(size);
+	header->structure_offset = htobe32(structure_offset);
+	header->strings_offset = htobe32(size);
+	header->reserve_map_offset = htobe32(reserve_offset);
+	header->version = htobe32(FDT_SUPPORTED_VERSION);
+	header->last_comp_version = htobe32(16);
+	header->structure_size = htobe32(sizeof(structure));
+	memcpy((uint8_t *)header + structure_offset, structure, sizeof(structure));
+
+	return header;
+}
+
+/* Roughly the size of the device tree of an arm64 Chromebook */
+static void build_tree(struct dt_bench *dtb)
+{
+	struct device_tree_node *cpus, *soc, *node;
+	u64 addr, size;
+	int i;
+
+	dtb->tree = fdt_unflatten(empty_fdt());
+
+	dt_add_u32_prop(dtb->tree->root, "#address-cells", 2);
+	dt_add_u32_prop(dtb->tree->root, "#size-cells", 2);
+	dt_add_string_prop(dtb->tree->root, "compatible", "google,board-rev1");
+	dt_add_string_prop(dtb->tree->root, "model", "Google Board");
+
+	node = add_node(dtb->tree->root, "chosen");
+	dt_add_string_prop(node, "bootargs", "console=ttyS0,115200n8 earlycon loglevel=7");
+
+	node = add_node(dtb->tree->root, "memory");
+	dt_add_string_prop(node, "device_type", "memory");
+	addr = 0x40000000;
+	size = 0x200000000;
+	dt_add_reg_prop(node, &addr, &size, 1, 2, 2);
+
+	cpus = add_node(dtb->tree->root, "cpus");
+	dt_add_u32_prop(cpus, "#address-cells", 1);
+	dt_add_u32_prop(cpus, "#size-cells", 0);
+	for (i = 0; i < DT_CPUS; i++) {
+		snprintf(dtb->names[i], sizeof(dtb->names[i]), "cpu@%x", i * 0x100);
+		node = add_node(cpus, dtb->names[i]);
+		dt_add_string_prop(node, "device_type", "cpu");
+		dt_add_string_prop(node, "compatible", "arm,cortex-a55");
+		dt_add_string_prop(node, "enable-method", "psci");
+		dt_add_u32_prop(node, "reg", i * 0x100);
+	}
+
+	soc = add_node(dtb->tree->root, "soc");
+	dt_add_u32_prop(soc, "#address-cells", 2);
+	dt_add_u32_prop(soc, "#size-cells", 2);
+	for (i = 0; i < DT_SOC_DEVICES; i++) {
+		addr = 0x11000000 + i * 0x10000;
+		size = 0x1000;
+		snprintf(dtb->names[DT_CPUS + i], sizeof(dtb->names[0]), "device@%llx",
+			 (unsigned long long)addr);
+		node = add_node(soc, dtb->names[DT_CPUS + i]);
+		dt_add_string_prop(node, "compatible", "vendor,soc-device");
+		dt_add_reg_prop(node, &addr, &size, 1, 2, 2);
+		dt_add_u32_prop(node, "interrupts", 32 + i);
+		dt_add_u32_prop(node, "clocks", i);
+		dt_add_u32_prop(node, "phandle", i + 1);
+		dt_add_string_prop(node, "status", i % 4 ? "okay" : "disabled");
+	}
+
+	dtb->blob_size = dt_flat_size(dtb->tree);
+	dtb->blob = malloc(dtb->blob_size);
+	dt_flatten(dtb->tree, dtb->blob);
+}
+
+/* The device tree library never frees, the benchmarks have to. */
+static void free_node(struct device_tree_node *node)
+{
+	struct list_node *l, *next;
+
+	for (l = node->properties.next; l; l = next) {
+		next = l->next;
+		free(container_of(l, struct device_tree_property, list_node));
+	}
+
+	for (l = node->children.next; l; l = next) {
+		next = l->next;
+		free_node(container_of(l, struct device_tree_node, list_node));
+	}
+
+	free(node);
+}
+
+static void free_unflattened_tree(struct device_tree *tree)
+{
+	struct list_node *l, *next;
+
+	for (l = tree->reserve_map.next; l; l = next) {
+		next = l->next;
+		free(container_of(l, struct device_tree_reserve_map_entry, list_node));
+	}
+
+	free_node(tree->root);
+	free(tree);
+}
+
+static int setup_device_tree(void **state)
+{
+	struct dt_bench *dtb = calloc(1, sizeof(*dtb));
+	struct device_tree *tree;
+
+	if (dtb == NULL)
+		return -1;
+
+	build_tree(dtb);
+
+	/* Make sure the blob is sane before timing anything. */
+	tree = fdt_unflatten(dtb->blob);
+	if (tree == NULL || dt_flat_size(tree) != dtb->blob_size)
+		return -1;
+	free_unflattened_tree(tree);
+
+	*state = dtb;
+	return 0;
+}
+
+static void bench_fdt_unflatten(struct bench_state *b)
+{
+	struct dt_bench *dtb = b->state;
+	struct device_tree *tree;
+	uint64_t i;
+
+	bench_set_bytes(b, dtb->blob_size);
+	for (i = 0; i < b->n; i++) {
+		tree = fdt_unflatten(dtb->blob);
+
+		bench_stop_timer(b);
+		free_unflattened_tree(tree);
+		bench_start_timer(b);
+	}
+}
+
+static void bench_dt_flatten(struct bench_state *b)
+{
+	struct dt_bench *dtb = b->state;
+	uint64_t i;
+
+	bench_set_bytes(b, dtb->blob_size);
+	for (i = 0; i < b->n; i++) {
+		bench_keep(dt_flat_size(dtb->tree));
+		dt_flatten(dtb->tree, dtb->blob);
+	}
+}
+
+static void bench_dt_find_node_by_path(struct bench_state *b)
+{
+	struct dt_bench *dtb = b->state;
+	char path[64];
+	uint64_t i;
+
+	snprintf(path, sizeof(path), "/soc/%s", dtb->names[DT_CPUS + DT_SOC_DEVICES - 1]);
+	for (i = 0; i < b->n; i++)
+		bench_keep(dt_find_node_by_path(dtb->tree, path, NULL, NULL, 0));
+}
+
+static void bench_dt_find_compat(struct bench_state *b)
+{
+	struct dt_bench *dtb = b->state;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++)
+		bench_keep(dt_find_compat(dtb->tree->root, "vendor,soc-device"));
+}
+
+int main(int argc, char *argv[])
+{
+	/* The trees are not freed, the process exits right after the benchmarks. */
+	const struct bench benches[] = {
+		bench_unit_setup_teardown(bench_fdt_unflatten, setup_device_tree, NULL),
+		bench_unit_setup_teardown(bench_dt_flatten, setup_device_tree, NULL),
+		bench_unit_setup_teardown(bench_dt_find_node_by_path, setup_device_tree, NULL),
+		bench_unit_setup_teardown(bench_dt_find_compat, setup_device_tree, NULL),
+	};
+
+	return bench_run_group(benches, argc, argv);
+}
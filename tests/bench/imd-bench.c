@@ -0,0 +1,131 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <commonlib/helpers.h>
+#include <imd.h>
+#include <stdlib.h>
+#include <tests/bench.h>
+#include <tests/test.h>
+
+/* Roughly the layout of CBMEM after ramstage */
+#define IMD_BUFFER_SIZE		(1 * MiB)
+#define IMD_LG_ROOT_SIZE	(4 * KiB)
+#define IMD_LG_ENTRY_ALIGN	(4 * KiB)
+#define IMD_SM_ROOT_SIZE	(1 * KiB)
+#define IMD_SM_ENTRY_ALIGN	32
+#define IMD_LG_ENTRIES		32
+#define IMD_SM_ENTRIES		24
+
+#define LG_ID(i)	(0x4c470000 + (i))
+#define SM_ID(i)	(0x534d0000 + (i))
+#define MISSING_ID	0xdeadbeef
+
+struct imd_bench {
+	void *buf;
+	struct imd imd;
+};
+
+static int setup_imd(void **state)
+{
+	struct imd_bench *ib = calloc(1, sizeof(*ib));
+	int i;
+
+	if (ib == NULL)
+		return -1;
+
+	ib->buf = malloc(IMD_BUFFER_SIZE);
+	if (ib->buf == NULL)
+		goto error;
+
+	imd_handle_init(&ib->imd, (uint8_t *)ib->buf + IMD_BUFFER_SIZE);
+	if (imd_create_tiered_empty(&ib->imd, IMD_LG_ROOT_SIZE, IMD_LG_ENTRY_ALIGN,
+				    IMD_SM_ROOT_SIZE, IMD_SM_ENTRY_ALIGN))
+		goto error;
+
+	for (i = 0; i < IMD_LG_ENTRIES; i++) {
+		if (!imd_entry_add(&ib->imd, LG_ID(i), 8 * KiB))
+			goto error;
+	}
+
+	for (i = 0; i < IMD_SM_ENTRIES; i++) {
+		if (!imd_entry_add(&ib->imd, SM_ID(i), 64))
+			goto error;
+	}
+
+	*state = ib;
+	return 0;
+
+error:
+	free(ib->buf);
+	free(ib);
+	return -1;
+}
+
+static int teardown_imd(void **state)
+{
+	struct imd_bench *ib = *state;
+
+	free(ib->buf);
+	free(ib);
+	return 0;
+}
+
+static void bench_imd_entry_find(struct bench_state *b, uint32_t id)
+{
+	struct imd_bench *ib = b->state;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++)
+		bench_keep(imd_entry_find(&ib->imd, id));
+}
+
+static void bench_imd_entry_find_first_large(struct bench_state *b)
+{
+	bench_imd_entry_find(b, LG_ID(0));
+}
+
+static void bench_imd_entry_find_last_large(struct bench_state *b)
+{
+	bench_imd_entry_find(b, LG_ID(IMD_LG_ENTRIES - 1));
+}
+
+static void bench_imd_entry_find_small(struct bench_state *b)
+{
+	bench_imd_entry_find(b, SM_ID(IMD_SM_ENTRIES - 1));
+}
+
+static void bench_imd_entry_find_missing(struct bench_state *b)
+{
+	bench_imd_entry_find(b, MISSING_ID);
+}
+
+static void bench_imd_cursor_walk(struct bench_state *b)
+{
+	struct imd_bench *ib = b->state;
+	struct imd_cursor cursor;
+	const struct imd_entry *e;
+	uint64_t i;
+	size_t total;
+
+	for (i = 0; i < b->n; i++) {
+		total = 0;
+		imd_cursor_init(&ib->imd, &cursor);
+		while ((e = imd_cursor_next(&cursor)))
+			total += imd_entry_size(e);
+		bench_keep(total);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	const struct bench benches[] = {
+		bench_unit_setup_teardown(bench_imd_entry_find_first_large, setup_imd,
+					  teardown_imd),
+		bench_unit_setup_teardown(bench_imd_entry_find_last_large, setup_imd,
+					  teardown_imd),
+		bench_unit_setup_teardown(bench_imd_entry_find_small, setup_imd, teardown_imd),
+		bench_unit_setup_teardown(bench_imd_entry_find_missing, setup_imd, teardown_imd),
+		bench_unit_setup_teardown(bench_imd_cursor_walk, setup_imd, teardown_imd),
+	};
+
+	return bench_run_group(benches, argc, argv);
+}
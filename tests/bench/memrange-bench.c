@@ -0,0 +1,124 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <commonlib/helpers.h>
+#include <device/device.h>
+#include <memrange.h>
+#include <tests/bench.h>
+#include <tests/test.h>
+
+/* memranges_add_resources() walks all devices */
+struct device *all_devices;
+
+#define MEMRANGE_ENTRIES	64
+
+enum mem_types {
+	CACHEABLE_TAG = 1,
+	RESERVED_TAG,
+	HOLE_TAG,
+};
+
+/* Large enough that the benchmarks never fall back to malloc() */
+static struct range_entry free_entries[4 * MEMRANGE_ENTRIES];
+
+/* Something like the map of a board with a few dozen reserved ranges below and above 4G. */
+static void build_memory_map(struct memranges *ranges)
+{
+	int i;
+
+	memranges_init_empty(ranges, free_entries, ARRAY_SIZE(free_entries));
+	memranges_insert(ranges, 0, 2ULL * GiB, CACHEABLE_TAG);
+	memranges_insert(ranges, 4ULL * GiB, 14ULL * GiB, CACHEABLE_TAG);
+	for (i = 0; i < MEMRANGE_ENTRIES / 2; i++) {
+		memranges_insert(ranges, 0x100000ULL + i * 64ULL * MiB, 4ULL * MiB,
+				 RESERVED_TAG);
+		memranges_insert(ranges, 4ULL * GiB + i * 256ULL * MiB, 16ULL * MiB,
+				 RESERVED_TAG);
+	}
+}
+
+static void bench_memranges_insert(struct bench_state *b)
+{
+	struct memranges ranges;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++) {
+		build_memory_map(&ranges);
+		memranges_teardown(&ranges);
+	}
+}
+
+static void bench_memranges_fill_holes(struct bench_state *b)
+{
+	struct memranges ranges;
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++) {
+		bench_stop_timer(b);
+		build_memory_map(&ranges);
+		bench_start_timer(b);
+
+		memranges_create_hole(&ranges, 1ULL * GiB, 512ULL * MiB);
+		memranges_fill_holes_up_to(&ranges, 32ULL * GiB, HOLE_TAG);
+
+		bench_stop_timer(b);
+		memranges_teardown(&ranges);
+		bench_start_timer(b);
+	}
+}
+
+static void bench_memranges_steal(struct bench_state *b)
+{
+	struct memranges ranges;
+	resource_t stolen;
+	uint64_t i;
+	int j;
+
+	for (i = 0; i < b->n; i++) {
+		bench_stop_timer(b);
+		build_memory_map(&ranges);
+		bench_start_timer(b);
+
+		for (j = 0; j < 16; j++)
+			memranges_steal(&ranges, 4ULL * GiB - 1, 1ULL * MiB, 20, CACHEABLE_TAG,
+					&stolen);
+
+		bench_stop_timer(b);
+		memranges_teardown(&ranges);
+		bench_start_timer(b);
+	}
+}
+
+static void bench_memranges_each_entry(struct bench_state *b)
+{
+	struct memranges ranges;
+	const struct range_entry *r;
+	resource_t total;
+	uint64_t i;
+
+	build_memory_map(&ranges);
+	bench_reset_timer(b);
+
+	for (i = 0; i < b->n; i++) {
+		total = 0;
+		memranges_each_entry(r, &ranges) {
+			if (range_entry_tag(r) == CACHEABLE_TAG)
+				total += range_entry_size(r);
+		}
+		bench_keep(total);
+	}
+
+	bench_stop_timer(b);
+	memranges_teardown(&ranges);
+}
+
+int main(int argc, char *argv[])
+{
+	const struct bench benches[] = {
+		bench_unit(bench_memranges_insert),
+		bench_unit(bench_memranges_fill_holes),
+		bench_unit(bench_memranges_steal),
+		bench_unit(bench_memranges_each_entry),
+	};
+
+	return bench_run_group(benches, argc, argv);
+}
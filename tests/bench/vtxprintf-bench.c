@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <console/vtxprintf.h>
+#include <stdarg.h>
+#include <tests/bench.h>
+#include <tests/test.h>
+
+struct sink {
+	size_t count;
+	unsigned char last;
+};
+
+static void tx_byte(unsigned char byte, void *data)
+{
+	struct sink *sink = data;
+
+	sink->count++;
+	sink->last = byte;
+}
+
+static void format(struct sink *sink, const char *fmt, ...)
+{
+	va_list args;
+
+	va_start(args, fmt);
+	vtxprintf(tx_byte, fmt, args, sink);
+	va_end(args);
+}
+
+/* Typical lines printed while booting */
+static void bench_vtxprintf_string(struct bench_state *b)
+{
+	struct sink sink = { 0 };
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++)
+		format(&sink, "%s: %s done after %d ms\n", "BS", "BS_DEV_INIT", 123);
+
+	bench_set_bytes(b, sink.count / b->n);
+	bench_keep(sink.last);
+}
+
+static void bench_vtxprintf_hex(struct bench_state *b)
+{
+	struct sink sink = { 0 };
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++)
+		format(&sink, "PCI: %02x:%02x.%01x [%04x/%04x] %s, res 0x%08llx size 0x%llx\n",
+		       0, 0x1f, 3, 0x8086, 0xa348, "enabled",
+		       (unsigned long long)0xfe000000 + i, 0x10000ULL);
+
+	bench_set_bytes(b, sink.count / b->n);
+	bench_keep(sink.last);
+}
+
+static void bench_vtxprintf_decimal(struct bench_state *b)
+{
+	struct sink sink = { 0 };
+	uint64_t i;
+
+	for (i = 0; i < b->n; i++)
+		format(&sink, "%d %u %ld %lld %5d %-5d|\n", -1234567, 4000000000u,
+		       (long)i, (long long)i * 1000000007, 42, 42);
+
+	bench_set_bytes(b, sink.count / b->n);
+	bench_keep(sink.last);
+}
+
+int main(int argc, char *argv[])
+{
+	const struct bench benches[] = {
+		bench_unit(bench_vtxprintf_string),
+		bench_unit(bench_vtxprintf_hex),
+		bench_unit(bench_vtxprintf_decimal),
+	};
+
+	return bench_run_group(benches, argc, argv);
+}
@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include "../drivers/intel/fsp2_0/hand_off_block.c"
+#include <commonlib/bsd/helpers.h>
+#include <stdlib.h>
+#include <tests/test.h>
+
+#define CBMEM_SIZE (32 * KiB)
+#define HOB_LIST_SIZE (1 * KiB)
+
+/* CBMEM top pointer used by implementation. */
+extern uintptr_t _cbmem_top_ptr;
+
+static const uint8_t guid_a[16] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+				    0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf };
+static const uint8_t guid_b[16] = { 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+				    0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf };
+static const uint8_t guid_c[16] = { 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+				    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf };
+static const uint8_t guid_d[16] = { 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+				    0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf };
+
+static uint64_t hob_list[HOB_LIST_SIZE / sizeof(uint64_t)];
+static uint8_t *hob_list_end;
+
+void cbmem_run_init_hooks(int is_recovery)
+{
+}
+
+static struct hob_header *new_hob(uint16_t type, size_t size)
+{
+	struct hob_header *hob = (struct hob_header *)hob_list_end;
+
+	memset(hob, 0, HOB_HEADER_LEN + size);
+	hob->type = type;
+	hob->length = HOB_HEADER_LEN + ALIGN_UP(size, 8);
+	hob_list_end += hob->length;
+	return hob;
+}
+
+static void end_hob_list(void)
+{
+	new_hob(HOB_TYPE_END_OF_HOB_LIST, 0);
+	/* Further HOBs replace the end of the list */
+	hob_list_end -= HOB_HEADER_LEN;
+}
+
+static void add_guid_hob(const uint8_t guid[16], uint64_t value)
+{
+	struct hob_header *hob = new_hob(HOB_TYPE_GUID_EXTENSION, 16 + sizeof(value));
+
+	memcpy((uint8_t *)hob + HOB_HEADER_LEN, guid, 16);
+	memcpy((uint8_t *)hob + HOB_HEADER_LEN + 16, &value, sizeof(value));
+}
+
+static void add_resource_hob(const uint8_t guid[16], uint64_t addr, uint64_t length)
+{
+	struct hob_header *hob = new_hob(HOB_TYPE_RESOURCE_DESCRIPTOR,
+					 sizeof(struct hob_resource));
+	struct hob_resource *res = (struct hob_resource *)((uint8_t *)hob + HOB_HEADER_LEN);
+
+	memcpy(res->owner_guid, guid, 16);
+	res->addr = addr;
+	res->length = length;
+}
+
+static int setup_test(void **state)
+{
+	void *cbmem_top_ptr = malloc(CBMEM_SIZE);
+	uint32_t *hob_list_loc;
+
+	if (!cbmem_top_ptr)
+		return -1;
+
+	memset(cbmem_top_ptr, 0, CBMEM_SIZE);
+	_cbmem_top_ptr = (uintptr_t)cbmem_top_ptr + CBMEM_SIZE;
+	cbmem_initialize_empty();
+
+	/* The HOBs FSP-M returns, saved to CBMEM with their index in romstage */
+	hob_list_end = (uint8_t *)hob_list;
+	add_guid_hob(guid_b, 0xb);
+	add_resource_hob(guid_c, 0xc000, 0x1000);
+	add_guid_hob(guid_a, 0xa);
+	add_guid_hob(guid_a, 0xa2);
+	end_hob_list();
+
+	hob_list_loc = cbmem_add(CBMEM_ID_FSP_RUNTIME, sizeof(*hob_list_loc));
+	if (!hob_list_loc)
+		return -1;
+	*hob_list_loc = (uintptr_t)hob_list;
+	save_hob_index((const struct hob_header *)hob_list);
+	return 0;
+}
+
+static int teardown_test(void **state)
+{
+	free((void *)(_cbmem_top_ptr - CBMEM_SIZE));
+	_cbmem_top_ptr = 0;
+	return 0;
+}
+
+static void assert_guid_hob(const uint8_t guid[16], uint64_t value)
+{
+	const void *data;
+	size_t size = 0;
+
+	data = fsp_find_extension_hob_by_guid(guid, &size);
+	assert_non_null(data);
+	assert_int_equal(sizeof(value), size);
+	assert_memory_equal(&value, data, sizeof(value));
+}
+
+static void test_find_indexed_hobs(void **state)
+{
+	struct range_entry re;
+	size_t size;
+
+	assert_non_null(cbmem_find(CBMEM_ID_FSP_HOB_INDEX));
+
+	assert_guid_hob(guid_b, 0xb);
+	/* The first of several HOBs with the same GUID */
+	assert_guid_hob(guid_a, 0xa);
+
+	assert_int_equal(0, fsp_find_range_hob(&re, guid_c));
+	assert_int_equal(0xc000, range_entry_base(&re));
+	assert_int_equal(0xd000, range_entry_end(&re));
+
+	assert_null(fsp_find_extension_hob_by_guid(guid_c, &size));
+	assert_null(fsp_find_extension_hob_by_guid(guid_d, &size));
+	assert_int_equal(-1, fsp_find_range_hob(&re, guid_a));
+}
+
+/* FSP-S appends HOBs to the list after the index was saved */
+static void test_find_appended_hobs(void **state)
+{
+	struct range_entry re;
+
+	add_guid_hob(guid_d, 0xd);
+	add_resource_hob(guid_d, 0xd000, 0x2000);
+	add_guid_hob(guid_c, 0xc);
+	end_hob_list();
+
+	assert_guid_hob(guid_d, 0xd);
+	assert_guid_hob(guid_c, 0xc);
+
+	assert_int_equal(0, fsp_find_range_hob(&re, guid_d));
+	assert_int_equal(0xd000, range_entry_base(&re));
+	assert_int_equal(0xf000, range_entry_end(&re));
+
+	/* HOBs in the index are still found first */
+	add_guid_hob(guid_a, 0xa3);
+	end_hob_list();
+	assert_guid_hob(guid_a, 0xa);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(test_find_indexed_hobs,
+						setup_test, teardown_test),
+		cmocka_unit_test_setup_teardown(test_find_appended_hobs,
+						setup_test, teardown_test),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,32 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef _TESTS_MOCKS_FSP_SOC_BINDING_H_
+#define _TESTS_MOCKS_FSP_SOC_BINDING_H_
+
+/*
+ * The FSP headers of a SoC only build for the target, this provides the few
+ * definitions the fsp2_0 driver headers need on the host.
+ */
+
+#include <stdint.h>
+
+#define EFI_SUCCESS		0
+#define EFI_INVALID_PARAMETER	2
+#define EFI_UNSUPPORTED		3
+#define EFI_DEVICE_ERROR	7
+#define EFI_NOT_STARTED		19
+#define EFI_NOT_FOUND		14
+
+typedef struct {
+	uint8_t reserved;
+} FSPM_UPD;
+
+typedef struct {
+	uint8_t reserved;
+} FSPS_UPD;
+
+typedef struct {
+	uint8_t reserved;
+} FSP_M_CONFIG;
+
+#endif /* _TESTS_MOCKS_FSP_SOC_BINDING_H_ */
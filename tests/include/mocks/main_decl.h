@@ -0,0 +1,8 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef _TESTS_MOCKS_MAIN_DECL_H_
+#define _TESTS_MOCKS_MAIN_DECL_H_
+
+/* Tests provide their own int main(void), don't declare the stage entry point. */
+
+#endif /* _TESTS_MOCKS_MAIN_DECL_H_ */
@@ -0,0 +1,74 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef _TESTS_BENCH_H
+#define _TESTS_BENCH_H
+
+#include <commonlib/helpers.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Minimal benchmark harness for the portable parts of coreboot. A benchmark runs its operation
+ * b->n times, the harness increases n until the run takes long enough to be measured. Results
+ * are printed one per line in the Go benchmark format, so the output of two commits can be
+ * compared with benchstat:
+ *
+ *   Benchmark_<name>  <n>  <t> ns/op  [<x> MB/s]  <y> B/op  <z> allocs/op
+ *
+ * Allocations are counted for calls to malloc(), calloc() and memalign() from the code linked
+ * into the benchmark.
+ */
+
+struct bench_state {
+	/* Number of times the benchmarked operation has to be run */
+	uint64_t n;
+	/* Set by the setup function */
+	void *state;
+
+	/* Private to the harness */
+	size_t bytes;
+	bool running;
+	uint64_t start_ns;
+	uint64_t elapsed_ns;
+	uint64_t start_allocs;
+	uint64_t allocs;
+	uint64_t start_alloc_bytes;
+	uint64_t alloc_bytes;
+};
+
+struct bench {
+	const char *name;
+	void (*fn)(struct bench_state *b);
+	/* Optional, run outside of the measurement. Same convention as Cmocka fixtures. */
+	int (*setup)(void **state);
+	int (*teardown)(void **state);
+};
+
+#define bench_unit(f) { #f, f, NULL, NULL }
+#define bench_unit_setup_teardown(f, s, t) { #f, f, s, t }
+
+/* Number of bytes processed by one operation, enables the MB/s column. */
+void bench_set_bytes(struct bench_state *b, size_t bytes);
+
+/* Exclude per-iteration preparation from the measurement. */
+void bench_stop_timer(struct bench_state *b);
+void bench_start_timer(struct bench_state *b);
+
+/* Discard the time and allocations measured so far. */
+void bench_reset_timer(struct bench_state *b);
+
+/* Keep the compiler from optimizing away a result that is otherwise unused. */
+#define bench_keep(x) __asm__ volatile("" : : "g"(x) : "memory")
+
+/*
+ * Run all benchmarks of a group. argv[1] optionally gives the minimum run time of each
+ * benchmark in milliseconds. Returns non-zero if a setup or teardown function failed.
+ */
+int _bench_run_group(const char *group, const struct bench *benches, size_t count,
+		     int argc, char *argv[]);
+
+#define bench_run_group(benches, argc, argv) \
+	_bench_run_group(__FILE__, benches, ARRAY_SIZE(benches), argc, argv)
+
+#endif /* _TESTS_BENCH_H */
@@ -0,0 +1,743 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef TESTS_BENCH_COMPRESSION_DATA_H
+#define TESTS_BENCH_COMPRESSION_DATA_H
+
+#include <stdint.h>
+
+/*
+ * LZ4 and LZMA compressed copies of the same data, the text of src/lib/imd.c at the time
+ * this file was created.
+ *
+ * Steps to regenerate the arrays, if needed:
+ * 1. Build util/cbfstool/cbfs-compression-tool.
+ * 2. Run `cbfs-compression-tool rawcompress <input> <output> <lz4|lzma>`.
+ * 3. Dump the output files as C arrays and update COMPRESSION_DATA_SIZE and
+ *    COMPRESSION_DATA_FNV1A with the size and the 32-bit FNV-1a hash of the input.
+ */
+
+#define COMPRESSION_DATA_SIZE 14799
+#define COMPRESSION_DATA_FNV1A 0xb5faac61
+
+static const uint8_t compression_data_lz4[] = {
+	0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0x6b, 0x13, 0x00, 0x00, 0xf7,
+	0x31, 0x2f, 0x2a, 0x20, 0x53, 0x50, 0x44, 0x58, 0x2d, 0x4c, 0x69, 0x63,
+	0x65, 0x6e, 0x73, 0x65, 0x2d, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
+	0x69, 0x65, 0x72, 0x3a, 0x20, 0x47, 0x50, 0x4c, 0x2d, 0x32, 0x2e, 0x30,
+	0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x23, 0x69,
+	0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x61, 0x73, 0x73, 0x65,
+	0x72, 0x74, 0x2e, 0x68, 0x3e, 0x14, 0x00, 0x5b, 0x63, 0x62, 0x6d, 0x65,
+	0x6d, 0x13, 0x00, 0x73, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2f, 0x08,
+	0x00, 0x0a, 0x1d, 0x00, 0x3a, 0x69, 0x6d, 0x64, 0x11, 0x00, 0x6c, 0x73,
+	0x74, 0x64, 0x6c, 0x69, 0x62, 0x14, 0x00, 0x4a, 0x72, 0x69, 0x6e, 0x67,
+	0x14, 0x00, 0x5d, 0x74, 0x79, 0x70, 0x65, 0x73, 0x4c, 0x00, 0x71, 0x5f,
+	0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x00, 0xf1, 0x32, 0x0a, 0x0a,
+	0x2f, 0x2a, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20,
+	0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x69,
+	0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x20,
+	0x70, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 0x65, 0x65, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x9c, 0x00, 0x81, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65,
+	0x72, 0x2e, 0xfc, 0x00, 0x10, 0x73, 0x33, 0x00, 0xf2, 0x0a, 0x63, 0x20,
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
+	0x76, 0x65, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x28, 0x17,
+	0x00, 0xf4, 0x18, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x73, 0x73, 0x69,
+	0x7a, 0x65, 0x5f, 0x74, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29,
+	0x0a, 0x7b, 0x0a, 0x09, 0x69, 0x6e, 0x74, 0x70, 0x74, 0x72, 0x5f, 0x74,
+	0x20, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x0e, 0x00, 0x10, 0x29, 0x30, 0x00,
+	0x73, 0x3b, 0x0a, 0x09, 0x62, 0x20, 0x2b, 0x3d, 0x2e, 0x00, 0xa3, 0x3b,
+	0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x53, 0x00, 0x55,
+	0x29, 0x62, 0x3b, 0x0a, 0x7d, 0x7e, 0x00, 0x40, 0x62, 0x6f, 0x6f, 0x6c,
+	0x9c, 0x00, 0x54, 0x5f, 0x72, 0x6f, 0x6f, 0x74, 0x7d, 0x00, 0x70, 0x5f,
+	0x76, 0x61, 0x6c, 0x69, 0x64, 0x28, 0x64, 0x01, 0x8d, 0x74, 0x20, 0x73,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x24, 0x00, 0x41, 0x20, 0x2a, 0x72, 0x70,
+	0x8a, 0x00, 0x03, 0x5e, 0x00, 0xf8, 0x14, 0x21, 0x21, 0x28, 0x72, 0x70,
+	0x2d, 0x3e, 0x6d, 0x61, 0x67, 0x69, 0x63, 0x20, 0x3d, 0x3d, 0x20, 0x49,
+	0x4d, 0x44, 0x5f, 0x52, 0x4f, 0x4f, 0x54, 0x5f, 0x50, 0x54, 0x52, 0x5f,
+	0x4d, 0x41, 0x47, 0x49, 0x43, 0x29, 0x78, 0x00, 0x0b, 0x56, 0x00, 0x61,
+	0x20, 0x2a, 0x69, 0x6d, 0x64, 0x72, 0x0b, 0x00, 0x0d, 0x77, 0x00, 0x12,
+	0x72, 0x1d, 0x00, 0x08, 0x6d, 0x00, 0x00, 0x10, 0x00, 0x31, 0x2d, 0x3e,
+	0x72, 0x51, 0x00, 0xa1, 0x2f, 0x2a, 0x0a, 0x20, 0x2a, 0x20, 0x54, 0x68,
+	0x65, 0x20, 0x49, 0x00, 0x04, 0x9f, 0x00, 0x34, 0x69, 0x73, 0x20, 0x54,
+	0x01, 0x31, 0x20, 0x74, 0x6f, 0x83, 0x01, 0xa0, 0x75, 0x70, 0x70, 0x65,
+	0x72, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x4b, 0x01, 0x05, 0x96, 0x01, 0xd0,
+	0x20, 0x69, 0x2e, 0x65, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x73, 0x69, 0x74,
+	0x73, 0x4c, 0x00, 0xac, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x6c,
+	0x6f, 0x77, 0x37, 0x00, 0x20, 0x2e, 0x0a, 0xba, 0x01, 0x0e, 0xc3, 0x00,
+	0x0a, 0x19, 0x01, 0x01, 0xcb, 0x00, 0x39, 0x67, 0x65, 0x74, 0x17, 0x00,
+	0x0f, 0xd7, 0x00, 0x0a, 0x0f, 0x64, 0x01, 0x08, 0x9d, 0x3b, 0x0a, 0x0a,
+	0x09, 0x72, 0x70, 0x20, 0x3d, 0x20, 0x22, 0x02, 0x04, 0xd0, 0x01, 0x02,
+	0x0d, 0x01, 0x01, 0xa0, 0x00, 0x30, 0x2c, 0x20, 0x2d, 0x2b, 0x02, 0x30,
+	0x6f, 0x66, 0x28, 0x9e, 0x01, 0x35, 0x29, 0x3b, 0x0a, 0x32, 0x01, 0x00,
+	0x49, 0x00, 0x1a, 0x7d, 0x74, 0x02, 0x00, 0x6e, 0x00, 0x42, 0x6c, 0x69,
+	0x6e, 0x6b, 0x76, 0x01, 0x0f, 0x83, 0x00, 0x08, 0x1e, 0x2c, 0xae, 0x01,
+	0x03, 0x8e, 0x01, 0x06, 0xf1, 0x01, 0x0f, 0xf0, 0x01, 0x00, 0x12, 0x3b,
+	0x21, 0x00, 0x01, 0x4e, 0x00, 0x02, 0x8c, 0x02, 0x03, 0xab, 0x02, 0x66,
+	0x33, 0x32, 0x5f, 0x74, 0x29, 0x28, 0xb5, 0x02, 0x37, 0x72, 0x20, 0x2d,
+	0xc3, 0x02, 0x2f, 0x72, 0x70, 0x29, 0x02, 0x05, 0x71, 0x65, 0x6e, 0x74,
+	0x72, 0x79, 0x20, 0x2a, 0x51, 0x00, 0x42, 0x6c, 0x61, 0x73, 0x74, 0x11,
+	0x00, 0x1f, 0x28, 0x9d, 0x00, 0x05, 0x02, 0xf9, 0x00, 0x40, 0x26, 0x72,
+	0x2d, 0x3e, 0x28, 0x00, 0xb3, 0x69, 0x65, 0x73, 0x5b, 0x72, 0x2d, 0x3e,
+	0x6e, 0x75, 0x6d, 0x5f, 0x0f, 0x00, 0x59, 0x20, 0x2d, 0x20, 0x31, 0x5d,
+	0x6b, 0x00, 0x02, 0x66, 0x03, 0x01, 0x60, 0x00, 0x07, 0x28, 0x00, 0x18,
+	0x28, 0x18, 0x00, 0x00, 0x0c, 0x00, 0x02, 0xb3, 0x01, 0x02, 0x15, 0x00,
+	0x03, 0x24, 0x00, 0x01, 0x18, 0x00, 0x00, 0x6f, 0x01, 0x08, 0x10, 0x00,
+	0x26, 0x20, 0x3d, 0x34, 0x00, 0x1b, 0x3b, 0x1b, 0x00, 0x33, 0x2d, 0x3d,
+	0x20, 0xaa, 0x01, 0x0f, 0x79, 0x01, 0x04, 0x1f, 0x29, 0x32, 0x00, 0x16,
+	0x08, 0xe7, 0x01, 0x09, 0x32, 0x00, 0x1f, 0x2f, 0x31, 0x00, 0x00, 0x01,
+	0x33, 0x01, 0x1f, 0x29, 0xf6, 0x00, 0x00, 0x05, 0x80, 0x00, 0x9f, 0x64,
+	0x61, 0x74, 0x61, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x59, 0x01, 0x05, 0x0e,
+	0x92, 0x01, 0x06, 0x8d, 0x01, 0x00, 0x8b, 0x00, 0x06, 0x0e, 0x00, 0x04,
+	0x01, 0x01, 0x07, 0xad, 0x01, 0x11, 0x72, 0xae, 0x00, 0x50, 0x69, 0x66,
+	0x20, 0x28, 0x72, 0x3c, 0x02, 0x14, 0x78, 0x1a, 0x02, 0x74, 0x21, 0x3d,
+	0x20, 0x30, 0x29, 0x0a, 0x09, 0xc8, 0x00, 0x06, 0x32, 0x00, 0x65, 0x2d,
+	0x3e, 0x73, 0x74, 0x61, 0x72, 0x42, 0x02, 0x29, 0x2d, 0x20, 0x38, 0x00,
+	0x07, 0xfb, 0x00, 0x13, 0x7e, 0xa8, 0x01, 0x2d, 0x29, 0x30, 0xe0, 0x04,
+	0x01, 0x85, 0x00, 0x8e, 0x69, 0x73, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
+	0xd8, 0x04, 0x0f, 0x37, 0x02, 0x01, 0x00, 0xcf, 0x04, 0x91, 0x2d, 0x3e,
+	0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0xdd, 0x02, 0xcf, 0x46, 0x4c,
+	0x41, 0x47, 0x5f, 0x4c, 0x4f, 0x43, 0x4b, 0x45, 0x44, 0x29, 0x4c, 0x03,
+	0x02, 0x01, 0xaf, 0x00, 0x8e, 0x5f, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e,
+	0x28, 0x25, 0x01, 0x43, 0x65, 0x2c, 0x20, 0x75, 0xfd, 0x02, 0x9a, 0x20,
+	0x69, 0x64, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0xd9, 0x05, 0x14, 0x2c,
+	0x8c, 0x01, 0x05, 0x65, 0x02, 0x1a, 0x65, 0x60, 0x03, 0x55, 0x45, 0x4e,
+	0x54, 0x52, 0x59, 0x5d, 0x03, 0x1b, 0x65, 0x1b, 0x01, 0x07, 0xf2, 0x05,
+	0x00, 0x1b, 0x00, 0x02, 0x81, 0x02, 0x04, 0x7c, 0x02, 0x9f, 0x2d, 0x3e,
+	0x69, 0x64, 0x20, 0x3d, 0x20, 0x69, 0x64, 0xbb, 0x00, 0x01, 0x7a, 0x72,
+	0x5f, 0x69, 0x6e, 0x69, 0x74, 0x28, 0x9c, 0x04, 0x23, 0x72, 0x2c, 0x9b,
+	0x06, 0x01, 0x00, 0x05, 0x11, 0x5f, 0x60, 0x04, 0x01, 0x95, 0x00, 0x15,
+	0x75, 0x7c, 0x06, 0x02, 0x4b, 0x05, 0x35, 0x3d, 0x20, 0x28, 0x13, 0x00,
+	0x17, 0x29, 0x2d, 0x00, 0x77, 0x3b, 0x0a, 0x09, 0x2f, 0x2a, 0x20, 0x55,
+	0x75, 0x05, 0xf0, 0x00, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e,
+	0x65, 0x64, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x98, 0x05, 0x40, 0x34, 0x4b,
+	0x69, 0x42, 0x54, 0x05, 0x24, 0x09, 0x69, 0xc4, 0x04, 0xe3, 0x20, 0x3d,
+	0x20, 0x41, 0x4c, 0x49, 0x47, 0x4e, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x28,
+	0xd7, 0x04, 0x61, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x5f, 0x18, 0x00, 0x22,
+	0x29, 0x3b, 0x2d, 0x00, 0x88, 0x72, 0x20, 0x3d, 0x20, 0x4e, 0x55, 0x4c,
+	0x4c, 0xd1, 0x00, 0x22, 0x69, 0x6e, 0xbf, 0x00, 0xed, 0x5f, 0x63, 0x72,
+	0x65, 0x61, 0x74, 0x65, 0x5f, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x28, 0x74,
+	0x05, 0x2c, 0x2c, 0x20, 0xd3, 0x03, 0x03, 0x8f, 0x01, 0x06, 0xd4, 0x03,
+	0x21, 0x79, 0x5f, 0xaa, 0x00, 0x0f, 0x9e, 0x05, 0x0f, 0x1e, 0x09, 0x48,
+	0x02, 0x1f, 0x3b, 0x24, 0x03, 0x01, 0x00, 0x86, 0x01, 0x18, 0x73, 0x77,
+	0x00, 0x06, 0xc1, 0x02, 0x00, 0x0e, 0x03, 0x17, 0x21, 0xc6, 0x05, 0x07,
+	0x08, 0x03, 0x41, 0x2d, 0x31, 0x3b, 0x0a, 0x47, 0x01, 0x05, 0xaa, 0x00,
+	0x01, 0x62, 0x08, 0x07, 0xa2, 0x00, 0xf0, 0x03, 0x20, 0x73, 0x68, 0x6f,
+	0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x70, 0x6f, 0x77,
+	0x65, 0x72, 0xdc, 0x06, 0x11, 0x32, 0x63, 0x08, 0x12, 0x09, 0x55, 0x09,
+	0xf6, 0x00, 0x28, 0x49, 0x53, 0x5f, 0x50, 0x4f, 0x57, 0x45, 0x52, 0x5f,
+	0x4f, 0x46, 0x5f, 0x32, 0x28, 0xc8, 0x04, 0x2f, 0x29, 0x3b, 0x23, 0x00,
+	0x04, 0x08, 0x02, 0x01, 0x12, 0x29, 0x82, 0x00, 0x38, 0x0a, 0x09, 0x20,
+	0x86, 0x00, 0x50, 0x6e, 0x65, 0x65, 0x64, 0x73, 0xc1, 0x01, 0xf0, 0x00,
+	0x62, 0x65, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x65, 0x6e, 0x6f,
+	0x75, 0x67, 0x68, 0x13, 0x00, 0xab, 0x61, 0x63, 0x63, 0x6f, 0x6d, 0x6d,
+	0x6f, 0x64, 0x61, 0x74, 0x94, 0x07, 0x35, 0x61, 0x6e, 0x64, 0x47, 0x00,
+	0x00, 0x9a, 0x03, 0x93, 0x6b, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x69, 0x6e,
+	0x67, 0x8d, 0x03, 0xc0, 0x75, 0x72, 0x65, 0x2e, 0x20, 0x46, 0x75, 0x72,
+	0x74, 0x68, 0x65, 0x72, 0x68, 0x09, 0x10, 0x2c, 0x80, 0x07, 0x1a, 0x72,
+	0x6d, 0x00, 0x71, 0x61, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x48, 0x00,
+	0x70, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x74, 0x20, 0x69, 0x09, 0x52, 0x74,
+	0x20, 0x6f, 0x6e, 0x65, 0x18, 0x01, 0x50, 0x20, 0x63, 0x6f, 0x76, 0x65,
+	0xe4, 0x09, 0x02, 0x68, 0x00, 0x71, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e,
+	0x2e, 0x22, 0x08, 0x65, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x50, 0x00,
+	0x01, 0x45, 0x00, 0x62, 0x65, 0x6e, 0x73, 0x75, 0x72, 0x65, 0x6a, 0x00,
+	0x24, 0x27, 0x73, 0xc7, 0x00, 0x41, 0x72, 0x6f, 0x6f, 0x6d, 0x60, 0x00,
+	0x50, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x4d, 0x00, 0xf1, 0x01, 0x69, 0x6e,
+	0x64, 0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6c, 0x20, 0x61, 0x6c, 0x6c,
+	0x6f, 0x63, 0xf0, 0x09, 0x20, 0x73, 0x2e, 0x44, 0x00, 0x13, 0x2f, 0xd2,
+	0x04, 0x05, 0x1e, 0x01, 0x37, 0x3c, 0x20, 0x28, 0x88, 0x07, 0x35, 0x20,
+	0x2b, 0x20, 0x0e, 0x00, 0x08, 0x0d, 0x00, 0x3f, 0x65, 0x29, 0x29, 0xeb,
+	0x01, 0x01, 0x00, 0x66, 0x0a, 0x10, 0x73, 0x57, 0x0a, 0xb1, 0x69, 0x63,
+	0x69, 0x74, 0x79, 0x20, 0x64, 0x6f, 0x6e, 0x27, 0x74, 0x73, 0x00, 0x11,
+	0x77, 0x3a, 0x00, 0x42, 0x73, 0x20, 0x6f, 0x72, 0x47, 0x03, 0x00, 0x76,
+	0x0a, 0x01, 0x17, 0x01, 0x68, 0x65, 0x78, 0x63, 0x65, 0x65, 0x64, 0x25,
+	0x03, 0x0f, 0x97, 0x00, 0x03, 0x18, 0x3e, 0x23, 0x00, 0x39, 0x20, 0x7c,
+	0x7c, 0x48, 0x02, 0x09, 0x1d, 0x00, 0x0f, 0x98, 0x00, 0x01, 0x40, 0x41,
+	0x64, 0x64, 0x69, 0xf4, 0x00, 0x53, 0x61, 0x6c, 0x6c, 0x79, 0x2c, 0x97,
+	0x00, 0x50, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x94, 0x02, 0x03, 0x7b, 0x01,
+	0x05, 0x98, 0x00, 0x26, 0x20, 0x3e, 0x2d, 0x02, 0x15, 0x2e, 0x8b, 0x00,
+	0x0a, 0x70, 0x00, 0x07, 0x51, 0x07, 0x0b, 0x6e, 0x00, 0x01, 0xf1, 0x08,
+	0x0f, 0x47, 0x09, 0x03, 0x01, 0x34, 0x09, 0x01, 0x24, 0x00, 0x09, 0x58,
+	0x08, 0x23, 0x2d, 0x28, 0x5d, 0x03, 0x18, 0x29, 0x73, 0x07, 0x00, 0x8c,
+	0x0c, 0x29, 0x65, 0x74, 0x85, 0x02, 0x03, 0x8d, 0x00, 0x02, 0x41, 0x0a,
+	0x0f, 0x57, 0x09, 0x16, 0x07, 0x6d, 0x00, 0x00, 0x35, 0x03, 0x00, 0x39,
+	0x00, 0x06, 0xb1, 0x0a, 0x03, 0x93, 0x00, 0x1a, 0x09, 0x51, 0x09, 0x00,
+	0x38, 0x09, 0x02, 0xaa, 0x00, 0xc7, 0x6d, 0x65, 0x6d, 0x73, 0x65, 0x74,
+	0x28, 0x72, 0x2c, 0x20, 0x30, 0x2c, 0x0a, 0x02, 0x01, 0x49, 0x00, 0x28,
+	0x2d, 0x3e, 0x14, 0x01, 0x18, 0x3d, 0x92, 0x01, 0x03, 0x77, 0x01, 0x60,
+	0x43, 0x61, 0x6c, 0x63, 0x75, 0x6c, 0x4c, 0x03, 0x01, 0xc4, 0x01, 0x00,
+	0x9a, 0x07, 0x01, 0x99, 0x02, 0x03, 0xeb, 0x07, 0x02, 0xd0, 0x00, 0x03,
+	0x15, 0x07, 0x04, 0xda, 0x08, 0x1e, 0x3d, 0xc5, 0x08, 0x06, 0x6d, 0x01,
+	0x04, 0x67, 0x02, 0xcc, 0x69, 0x6c, 0x6c, 0x20, 0x69, 0x6e, 0x20, 0x66,
+	0x69, 0x72, 0x73, 0x74, 0x3a, 0x03, 0x00, 0xf8, 0x0a, 0x09, 0x3e, 0x03,
+	0x03, 0x65, 0x00, 0x08, 0x3f, 0x09, 0x30, 0x3d, 0x20, 0x31, 0x5a, 0x06,
+	0x29, 0x20, 0x3d, 0x64, 0x09, 0x23, 0x30, 0x5d, 0x0a, 0x01, 0x09, 0x0f,
+	0x07, 0xc4, 0x65, 0x2c, 0x20, 0x43, 0x42, 0x4d, 0x45, 0x4d, 0x5f, 0x49,
+	0x44, 0x5f, 0x2a, 0x0a, 0x01, 0x0f, 0x01, 0x0a, 0x97, 0x00, 0xf2, 0x09,
+	0x70, 0x72, 0x69, 0x6e, 0x74, 0x6b, 0x28, 0x42, 0x49, 0x4f, 0x53, 0x5f,
+	0x44, 0x45, 0x42, 0x55, 0x47, 0x2c, 0x20, 0x22, 0x49, 0x4d, 0x44, 0x3a,
+	0x8c, 0x00, 0x75, 0x40, 0x20, 0x25, 0x70, 0x20, 0x25, 0x75, 0xfa, 0x00,
+	0x8a, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x72, 0x2c, 0x20, 0xfd, 0x00, 0x08,
+	0x0f, 0x09, 0x1f, 0x30, 0x1d, 0x06, 0x02, 0x21, 0x72, 0x65, 0xe8, 0x00,
+	0x0e, 0x18, 0x06, 0x0f, 0xee, 0x05, 0x25, 0x07, 0x12, 0x07, 0x25, 0x6f,
+	0x77, 0xfd, 0x06, 0x04, 0x59, 0x09, 0x0f, 0xe3, 0x05, 0x01, 0x0f, 0xf2,
+	0x02, 0x22, 0x04, 0x45, 0x00, 0x0f, 0xac, 0x0d, 0x01, 0x2e, 0x72, 0x70,
+	0x4c, 0x04, 0x0f, 0xdf, 0x02, 0x02, 0x01, 0x97, 0x02, 0x0a, 0x97, 0x0b,
+	0x04, 0x12, 0x02, 0x14, 0x45, 0x0a, 0x05, 0x13, 0x61, 0x33, 0x03, 0x22,
+	0x69, 0x73, 0x0c, 0x0d, 0x7c, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74,
+	0x63, 0x0d, 0x04, 0xd6, 0x03, 0x08, 0xbc, 0x0b, 0x09, 0xcb, 0x0b, 0x0b,
+	0x7c, 0x0b, 0x07, 0xa5, 0x01, 0x3f, 0x5d, 0x20, 0x3e, 0x9d, 0x0a, 0x06,
+	0x0d, 0xc8, 0x00, 0x03, 0x2e, 0x0a, 0x08, 0x7c, 0x02, 0x1c, 0x3e, 0xf5,
+	0x01, 0x0f, 0xb0, 0x04, 0x00, 0x1b, 0x45, 0x92, 0x04, 0x06, 0x29, 0x07,
+	0x0c, 0x27, 0x07, 0x01, 0x59, 0x01, 0x0b, 0x25, 0x07, 0x09, 0x99, 0x03,
+	0x0e, 0x94, 0x00, 0x05, 0xe9, 0x01, 0x0a, 0xff, 0x08, 0x0e, 0x6f, 0x01,
+	0x05, 0x9f, 0x02, 0x0a, 0x6c, 0x01, 0x67, 0x49, 0x66, 0x20, 0x6e, 0x6f,
+	0x20, 0x01, 0x0b, 0x40, 0x74, 0x68, 0x65, 0x6e, 0x3f, 0x02, 0x36, 0x65,
+	0x73, 0x74, 0x2e, 0x09, 0x16, 0x30, 0xa0, 0x00, 0x07, 0x71, 0x00, 0x0a,
+	0x72, 0x00, 0x00, 0x9b, 0x00, 0x08, 0x8e, 0x00, 0x10, 0x30, 0x62, 0x00,
+	0x00, 0x21, 0x04, 0x21, 0x28, 0x69, 0x0e, 0x00, 0x5a, 0x20, 0x69, 0x20,
+	0x3c, 0x20, 0x3f, 0x01, 0xa7, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20,
+	0x7b, 0x0a, 0x09, 0xbb, 0x02, 0x02, 0x4c, 0x0a, 0x30, 0x61, 0x64, 0x64,
+	0xd2, 0x02, 0x1d, 0x09, 0x24, 0x0b, 0x04, 0xc7, 0x08, 0x0b, 0xef, 0x03,
+	0x20, 0x69, 0x5d, 0x6f, 0x00, 0x02, 0xdd, 0x05, 0x04, 0xad, 0x0a, 0x1d,
+	0x21, 0xae, 0x0a, 0x00, 0xa4, 0x00, 0x0a, 0x40, 0x01, 0x16, 0x09, 0x6f,
+	0x00, 0x0f, 0x42, 0x01, 0x0f, 0x0b, 0xea, 0x0a, 0x23, 0x29, 0x3b, 0x72,
+	0x00, 0x07, 0x44, 0x00, 0x26, 0x20, 0x3c, 0x7c, 0x03, 0x0c, 0x6e, 0x00,
+	0x0d, 0x2d, 0x00, 0x37, 0x3e, 0x3d, 0x20, 0x8c, 0x03, 0x31, 0x20, 0x7c,
+	0x7c, 0xfe, 0x09, 0x08, 0x22, 0x00, 0x23, 0x2b, 0x20, 0x43, 0x0b, 0x38,
+	0x29, 0x20, 0x3e, 0x2c, 0x00, 0x0d, 0x5b, 0x00, 0x2f, 0x7d, 0x0a, 0x66,
+	0x06, 0x13, 0x0f, 0x95, 0x04, 0x05, 0x0f, 0x68, 0x01, 0x05, 0x01, 0x0b,
+	0x04, 0x02, 0x82, 0x02, 0x4f, 0x66, 0x69, 0x6e, 0x64, 0x3e, 0x10, 0x05,
+	0x02, 0xb8, 0x0a, 0x27, 0x09, 0x09, 0x5a, 0x0c, 0x0e, 0xc5, 0x04, 0x0f,
+	0x95, 0x0a, 0x0c, 0x07, 0xa7, 0x04, 0x0f, 0xd8, 0x06, 0x02, 0x03, 0x81,
+	0x03, 0x22, 0x20, 0x3d, 0x70, 0x0b, 0x07, 0x0b, 0x03, 0x02, 0x7f, 0x0b,
+	0x02, 0x04, 0x06, 0x02, 0x8b, 0x0b, 0x01, 0x0c, 0x01, 0x3f, 0x6b, 0x69,
+	0x70, 0x56, 0x06, 0x0b, 0x02, 0x1e, 0x01, 0x05, 0xa4, 0x02, 0x1f, 0x31,
+	0xa4, 0x02, 0x0c, 0x00, 0x7f, 0x00, 0x20, 0x69, 0x64, 0x57, 0x02, 0x09,
+	0x79, 0x02, 0x31, 0x2e, 0x69, 0x64, 0x8f, 0x01, 0x70, 0x63, 0x6f, 0x6e,
+	0x74, 0x69, 0x6e, 0x75, 0xcc, 0x00, 0x1f, 0x09, 0x9f, 0x02, 0x01, 0x73,
+	0x09, 0x09, 0x62, 0x72, 0x65, 0x61, 0x6b, 0xad, 0x01, 0x04, 0x29, 0x0f,
+	0x0f, 0x1a, 0x06, 0x02, 0x01, 0xe4, 0x01, 0x01, 0x8f, 0x06, 0x0f, 0x35,
+	0x0c, 0x08, 0x00, 0xb5, 0x03, 0x06, 0x07, 0x10, 0x0f, 0x69, 0x01, 0x02,
+	0x04, 0xc8, 0x0d, 0x04, 0x2b, 0x00, 0x06, 0x67, 0x01, 0x07, 0x9e, 0x08,
+	0x0f, 0x47, 0x08, 0x03, 0x0f, 0x6e, 0x01, 0x07, 0x03, 0xd5, 0x05, 0x05,
+	0xce, 0x09, 0x0a, 0xc5, 0x02, 0x19, 0x2d, 0x45, 0x03, 0x04, 0xb6, 0x01,
+	0x04, 0x81, 0x00, 0x2f, 0x20, 0x3c, 0x6e, 0x09, 0x08, 0x70, 0x2f, 0x2a,
+	0x20, 0x54, 0x61, 0x6b, 0x65, 0x07, 0x01, 0x02, 0xbd, 0x0b, 0x36, 0x75,
+	0x6e, 0x74, 0xee, 0x05, 0x06, 0xc2, 0x09, 0x05, 0xcf, 0x00, 0x25, 0x20,
+	0x3d, 0x05, 0x01, 0x29, 0x20, 0x2d, 0xe4, 0x10, 0x08, 0x23, 0x00, 0x17,
+	0x2d, 0xff, 0x00, 0x2a, 0x0a, 0x09, 0xef, 0x0f, 0x18, 0x3d, 0x1c, 0x01,
+	0x0f, 0x1a, 0x03, 0x03, 0x06, 0x98, 0x10, 0x04, 0x09, 0x03, 0x01, 0x98,
+	0x01, 0x0f, 0x99, 0x04, 0x06, 0x08, 0xbe, 0x0f, 0x03, 0xbd, 0x03, 0x0d,
+	0xec, 0x0e, 0x08, 0x57, 0x03, 0x1f, 0x61, 0x6a, 0x14, 0x06, 0x2f, 0x2c,
+	0x20, 0x65, 0x00, 0x12, 0x0d, 0xaa, 0x04, 0x0b, 0xcb, 0x01, 0x0e, 0xb8,
+	0x04, 0x0f, 0xd8, 0x12, 0x0b, 0x07, 0x35, 0x09, 0x5f, 0x64, 0x64, 0x5f,
+	0x74, 0x6f, 0x98, 0x13, 0x02, 0x3f, 0x20, 0x2a, 0x72, 0x48, 0x10, 0x00,
+	0x2c, 0x09, 0x09, 0x3a, 0x10, 0x0f, 0xbc, 0x00, 0x00, 0x02, 0xa0, 0x11,
+	0x0f, 0xbf, 0x11, 0x0c, 0x05, 0xbc, 0x02, 0x15, 0x65, 0xa1, 0x0e, 0x04,
+	0xc9, 0x08, 0x45, 0x75, 0x73, 0x65, 0x64, 0xb2, 0x01, 0x0f, 0x94, 0x07,
+	0x00, 0x2f, 0x3d, 0x3d, 0x95, 0x07, 0x07, 0x04, 0x2a, 0x04, 0xb0, 0x2f,
+	0x2a, 0x20, 0x44, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x97, 0x15,
+	0x32, 0x74, 0x61, 0x6c, 0xd6, 0x0a, 0xb2, 0x74, 0x61, 0x6b, 0x65, 0x6e,
+	0x20, 0x75, 0x70, 0x20, 0x62, 0x79, 0x35, 0x04, 0x02, 0x72, 0x02, 0x05,
+	0x73, 0x00, 0x05, 0x15, 0x10, 0x21, 0x55, 0x50, 0x5a, 0x0d, 0x2b, 0x2c,
+	0x20, 0xa1, 0x07, 0x14, 0x3b, 0x88, 0x05, 0x42, 0x65, 0x20, 0x69, 0x66,
+	0x54, 0x00, 0x00, 0x76, 0x04, 0x50, 0x66, 0x6c, 0x6f, 0x77, 0x73, 0xec,
+	0x00, 0x07, 0x6d, 0x00, 0x06, 0x8f, 0x0c, 0x06, 0x5f, 0x00, 0x1f, 0x3e,
+	0x00, 0x13, 0x01, 0x2f, 0x72, 0x29, 0xc2, 0x00, 0x02, 0x01, 0x36, 0x0e,
+	0x06, 0xc6, 0x00, 0x23, 0x69, 0x66, 0x78, 0x11, 0x66, 0x20, 0x66, 0x69,
+	0x65, 0x6c, 0x64, 0x77, 0x00, 0x53, 0x2e, 0x20, 0x41, 0x6c, 0x6c, 0x1c,
+	0x00, 0x17, 0x73, 0x7e, 0x08, 0x00, 0xe5, 0x07, 0x11, 0x72, 0x45, 0x00,
+	0x41, 0x74, 0x68, 0x61, 0x6e, 0x69, 0x03, 0x70, 0x70, 0x72, 0x65, 0x76,
+	0x69, 0x6f, 0x75, 0x51, 0x18, 0x14, 0x65, 0xbb, 0x0d, 0x0f, 0x47, 0x13,
+	0x0e, 0x26, 0x09, 0x65, 0x4e, 0x03, 0x0f, 0x30, 0x13, 0x05, 0x08, 0x26,
+	0x00, 0x35, 0x2d, 0x3d, 0x20, 0x25, 0x0d, 0x07, 0xcc, 0x01, 0x02, 0xbc,
+	0x07, 0x04, 0x25, 0x00, 0x1f, 0x3e, 0x4c, 0x00, 0x07, 0x0f, 0xf9, 0x05,
+	0x01, 0x0f, 0x9f, 0x00, 0x06, 0x21, 0x20, 0x2b, 0x1e, 0x0c, 0x0a, 0x33,
+	0x0c, 0x4f, 0x2b, 0x2b, 0x3b, 0x0a, 0x1d, 0x0c, 0x01, 0x00, 0x0d, 0x00,
+	0x10, 0x2c, 0xcd, 0x02, 0x05, 0x76, 0x02, 0x02, 0x0b, 0x13, 0x0c, 0xda,
+	0x14, 0x1f, 0x79, 0x3a, 0x07, 0x1c, 0x2f, 0x61, 0x64, 0x39, 0x07, 0x19,
+	0x0e, 0x7f, 0x13, 0x0f, 0xdd, 0x05, 0x01, 0x0f, 0x25, 0x07, 0x26, 0x05,
+	0x8b, 0x0f, 0x06, 0x89, 0x14, 0x0f, 0x61, 0x02, 0x02, 0x06, 0xe3, 0x18,
+	0x0f, 0x0e, 0x04, 0x00, 0x25, 0x72, 0x2c, 0xa9, 0x00, 0x1f, 0x29, 0xc7,
+	0x19, 0x01, 0x53, 0x72, 0x5f, 0x68, 0x61, 0x73, 0x85, 0x01, 0x0f, 0xde,
+	0x04, 0x24, 0x0f, 0xd2, 0x06, 0x03, 0x03, 0x8d, 0x05, 0x2f, 0x64, 0x78,
+	0xb8, 0x06, 0x1f, 0x5d, 0x66, 0x61, 0x6c, 0x73, 0x65, 0xfd, 0x03, 0x12,
+	0x69, 0x81, 0x19, 0x02, 0xb2, 0x11, 0x80, 0x69, 0x73, 0x20, 0x77, 0x69,
+	0x74, 0x68, 0x69, 0x0e, 0x03, 0x23, 0x69, 0x73, 0x78, 0x06, 0x06, 0x13,
+	0x12, 0x01, 0xb0, 0x03, 0x20, 0x64, 0x78, 0x1f, 0x0f, 0x2f, 0x20, 0x2d,
+	0x6e, 0x0e, 0x00, 0x01, 0x20, 0x08, 0x10, 0x78, 0xbc, 0x02, 0x0a, 0x44,
+	0x08, 0x0f, 0x85, 0x00, 0x01, 0x03, 0x10, 0x00, 0x4f, 0x74, 0x72, 0x75,
+	0x65, 0x4e, 0x02, 0x09, 0x18, 0x72, 0x90, 0x05, 0x30, 0x74, 0x6f, 0x5f,
+	0x13, 0x00, 0x0d, 0x52, 0x01, 0x01, 0x24, 0x00, 0x04, 0x4a, 0x02, 0x0f,
+	0x32, 0x0b, 0x06, 0x01, 0xd5, 0x0c, 0x23, 0x0a, 0x7b, 0xa8, 0x00, 0x0a,
+	0xa4, 0x01, 0xad, 0x26, 0x69, 0x6d, 0x64, 0x2d, 0x3e, 0x6c, 0x67, 0x2c,
+	0x20, 0xfc, 0x0c, 0x04, 0x1b, 0x00, 0x2f, 0x3b, 0x0a, 0x3a, 0x00, 0x08,
+	0x2f, 0x73, 0x6d, 0x3a, 0x00, 0x06, 0x27, 0x73, 0x6d, 0xef, 0x00, 0x05,
+	0x29, 0x15, 0x00, 0x7b, 0x0c, 0x81, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+	0x69, 0x7a, 0xff, 0x1a, 0x03, 0xc3, 0x11, 0x01, 0x65, 0x01, 0x05, 0xcb,
+	0x16, 0x02, 0x14, 0x00, 0x0c, 0x16, 0x16, 0x02, 0xef, 0x00, 0x0f, 0x16,
+	0x16, 0x04, 0x06, 0x47, 0x16, 0x06, 0xd4, 0x00, 0x08, 0x24, 0x00, 0x1e,
+	0x3b, 0x23, 0x00, 0x00, 0xbd, 0x00, 0x01, 0x2c, 0x02, 0x01, 0x9a, 0x00,
+	0x0f, 0x7d, 0x00, 0x01, 0x40, 0x5f, 0x70, 0x61, 0x72, 0xac, 0x00, 0x04,
+	0xb3, 0x0f, 0x1c, 0x79, 0x8e, 0x00, 0x01, 0x7b, 0x00, 0x0f, 0x7a, 0x01,
+	0x06, 0x1f, 0x3b, 0xce, 0x0f, 0x17, 0x03, 0x1d, 0x03, 0x07, 0x6d, 0x01,
+	0x00, 0xc3, 0x00, 0x15, 0x2e, 0x72, 0x0d, 0x07, 0x9d, 0x18, 0x04, 0xc4,
+	0x04, 0x08, 0x25, 0x01, 0x01, 0x19, 0x01, 0x07, 0x3a, 0x12, 0x06, 0x3d,
+	0x00, 0x05, 0xf1, 0x0d, 0x06, 0x76, 0x01, 0x09, 0x45, 0x0f, 0x01, 0x64,
+	0x14, 0x14, 0x68, 0x45, 0x15, 0x02, 0x6f, 0x11, 0x16, 0x73, 0x3f, 0x0c,
+	0x27, 0x20, 0x3d, 0x09, 0x02, 0x0f, 0x26, 0x10, 0x10, 0x0e, 0xda, 0x12,
+	0x0f, 0xfb, 0x0f, 0x0f, 0x04, 0x4b, 0x0a, 0x08, 0x70, 0x0c, 0x02, 0x2a,
+	0x04, 0xf5, 0x00, 0x53, 0x4d, 0x41, 0x4c, 0x4c, 0x5f, 0x52, 0x45, 0x47,
+	0x49, 0x4f, 0x4e, 0x5f, 0x49, 0x44, 0xe8, 0x04, 0x1e, 0x65, 0xe7, 0x03,
+	0x03, 0x16, 0x01, 0x00, 0xd6, 0x01, 0x1f, 0x2e, 0x19, 0x0f, 0x00, 0x0a,
+	0x79, 0x09, 0x02, 0x5e, 0x00, 0x00, 0xc3, 0x04, 0x0b, 0x34, 0x00, 0x2d,
+	0x2b, 0x3d, 0xf1, 0x09, 0x04, 0x26, 0x00, 0x06, 0x0b, 0x01, 0x00, 0xda,
+	0x02, 0x0f, 0x0b, 0x01, 0x42, 0x33, 0x7d, 0x0a, 0x0a, 0x0b, 0x0c, 0x0f,
+	0x41, 0x18, 0x05, 0x03, 0x03, 0x03, 0x0d, 0x3f, 0x18, 0x1f, 0x20, 0x3b,
+	0x18, 0x04, 0x07, 0xb0, 0x1e, 0x0a, 0x94, 0x18, 0x06, 0x25, 0x03, 0x07,
+	0x45, 0x00, 0x0a, 0xd1, 0x08, 0x0e, 0x8e, 0x00, 0x6f, 0x74, 0x69, 0x65,
+	0x72, 0x65, 0x64, 0x95, 0x00, 0x04, 0x08, 0xc2, 0x18, 0x3e, 0x6c, 0x67,
+	0x5f, 0x9c, 0x00, 0x37, 0x6c, 0x67, 0x5f, 0x61, 0x00, 0x09, 0x30, 0x00,
+	0x2f, 0x73, 0x6d, 0x30, 0x00, 0x00, 0x3d, 0x73, 0x6d, 0x5f, 0x0a, 0x19,
+	0x06, 0x2f, 0x00, 0x01, 0xa9, 0x02, 0x04, 0x43, 0x08, 0x0f, 0x82, 0x03,
+	0x13, 0x08, 0x64, 0x03, 0x0c, 0xdb, 0x02, 0x07, 0xe4, 0x04, 0x09, 0x28,
+	0x01, 0x02, 0x2a, 0x02, 0x0a, 0xd0, 0x00, 0x0a, 0xc9, 0x00, 0x1c, 0x29,
+	0x3c, 0x1c, 0x2d, 0x2d, 0x31, 0x3a, 0x15, 0x23, 0x74, 0x68, 0x3e, 0x15,
+	0x03, 0xf7, 0x1f, 0x53, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x6d, 0x03, 0x00,
+	0x41, 0x17, 0x63, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x98, 0x0e, 0x0a,
+	0xde, 0x00, 0x0f, 0x4c, 0x15, 0x01, 0x08, 0x2f, 0x01, 0x3b, 0x29, 0x20,
+	0x2a, 0x2a, 0x01, 0x1d, 0x3b, 0x43, 0x00, 0x29, 0x2b, 0x3d, 0x62, 0x01,
+	0x1f, 0x3b, 0x64, 0x00, 0x00, 0x06, 0xde, 0x0a, 0x09, 0x1a, 0x00, 0x0d,
+	0xed, 0x00, 0x06, 0x8c, 0x17, 0x63, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77,
+	0x41, 0x07, 0x2d, 0x74, 0x6f, 0x45, 0x04, 0x00, 0x14, 0x00, 0x01, 0x35,
+	0x05, 0x06, 0xb9, 0x13, 0x04, 0x3b, 0x1a, 0x05, 0x37, 0x16, 0x0b, 0xfa,
+	0x03, 0x2f, 0x61, 0x64, 0xf9, 0x03, 0x04, 0x1b, 0x2c, 0xf3, 0x01, 0x0f,
+	0x09, 0x04, 0x03, 0x9f, 0x67, 0x6f, 0x74, 0x6f, 0x20, 0x66, 0x61, 0x69,
+	0x6c, 0x0c, 0x04, 0x36, 0x0c, 0x69, 0x02, 0x0f, 0x26, 0x02, 0x05, 0x06,
+	0x50, 0x06, 0x0b, 0xca, 0x02, 0x1e, 0x6d, 0x2a, 0x02, 0x02, 0xef, 0x11,
+	0x0c, 0xef, 0x0f, 0x0a, 0x42, 0x00, 0x07, 0xea, 0x00, 0x0d, 0xd9, 0x00,
+	0x06, 0xac, 0x0e, 0x00, 0x12, 0x00, 0x1f, 0x3a, 0x0c, 0x06, 0x0f, 0x05,
+	0x3c, 0x12, 0x28, 0x3b, 0x0a, 0xa3, 0x02, 0x07, 0xdf, 0x03, 0x0e, 0x91,
+	0x16, 0x0f, 0xdd, 0x06, 0x13, 0x07, 0xbd, 0x13, 0x00, 0xd1, 0x02, 0x1a,
+	0x5f, 0x7d, 0x1d, 0x0f, 0x79, 0x03, 0x13, 0x06, 0x52, 0x01, 0x04, 0x17,
+	0x17, 0x01, 0x3f, 0x05, 0x0f, 0x55, 0x03, 0x06, 0x09, 0xc2, 0x09, 0x09,
+	0x48, 0x03, 0x20, 0x69, 0x73, 0xc8, 0x0c, 0x33, 0x73, 0x65, 0x6e, 0x48,
+	0x03, 0x0f, 0x57, 0x06, 0x32, 0x02, 0xcf, 0x14, 0x0d, 0xdf, 0x00, 0x0f,
+	0x51, 0x02, 0x14, 0x0e, 0x38, 0x00, 0x0f, 0x61, 0x06, 0x04, 0x0e, 0xb0,
+	0x02, 0x0f, 0x52, 0x01, 0x00, 0x02, 0x2a, 0x11, 0x32, 0x65, 0x61, 0x72,
+	0xbe, 0x1e, 0xa1, 0x61, 0x6e, 0x79, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67,
+	0x65, 0x09, 0x26, 0x00, 0x0e, 0x02, 0x06, 0xae, 0x0a, 0x0c, 0x55, 0x01,
+	0x04, 0x60, 0x02, 0x03, 0x59, 0x01, 0x02, 0xd8, 0x12, 0x0f, 0x45, 0x08,
+	0x19, 0x0e, 0x77, 0x14, 0x09, 0x35, 0x11, 0x04, 0x4b, 0x02, 0x0e, 0xc2,
+	0x12, 0x0d, 0xb6, 0x06, 0x09, 0xc0, 0x12, 0x08, 0xa1, 0x06, 0x0d, 0x0f,
+	0x03, 0x00, 0x9f, 0x06, 0x05, 0x2e, 0x00, 0x0a, 0x67, 0x00, 0x30, 0x6f,
+	0x63, 0x6b, 0x05, 0x01, 0x0e, 0xb3, 0x02, 0x0f, 0x37, 0x0d, 0x14, 0x04,
+	0x61, 0x00, 0x0f, 0xf1, 0x12, 0x10, 0x04, 0x87, 0x21, 0x2c, 0x7c, 0x3d,
+	0x88, 0x21, 0x0f, 0x57, 0x00, 0x05, 0x26, 0x73, 0x6d, 0x57, 0x00, 0x17,
+	0x21, 0x57, 0x00, 0x0f, 0x4a, 0x00, 0x0c, 0x0f, 0x50, 0x01, 0x01, 0x03,
+	0x0b, 0x04, 0x00, 0x30, 0x0f, 0x0f, 0x0a, 0x0b, 0x05, 0x04, 0xa5, 0x27,
+	0x02, 0x36, 0x07, 0x1e, 0x2a, 0x1b, 0x14, 0x0f, 0x84, 0x15, 0x0f, 0x02,
+	0x49, 0x00, 0x00, 0xc1, 0x16, 0x03, 0x80, 0x17, 0x04, 0x69, 0x07, 0x11,
+	0x7a, 0x7a, 0x00, 0x08, 0xfd, 0x19, 0x07, 0x15, 0x02, 0x0d, 0x44, 0x1a,
+	0x0f, 0x62, 0x01, 0x05, 0x0f, 0x63, 0x01, 0x0d, 0x00, 0xa7, 0x21, 0x10,
+	0x73, 0x3e, 0x06, 0x26, 0x73, 0x74, 0x50, 0x06, 0x55, 0x6f, 0x62, 0x74,
+	0x61, 0x69, 0x93, 0x18, 0x00, 0x98, 0x00, 0x27, 0x65, 0x73, 0x37, 0x06,
+	0x0f, 0xd9, 0x23, 0x03, 0x04, 0xc3, 0x00, 0x0e, 0x74, 0x09, 0x0f, 0xc9,
+	0x17, 0x04, 0x02, 0x54, 0x03, 0x06, 0x09, 0x12, 0x00, 0xef, 0x00, 0x00,
+	0x4a, 0x04, 0x28, 0x74, 0x68, 0x90, 0x00, 0x30, 0x27, 0x73, 0x20, 0x65,
+	0x01, 0x00, 0x21, 0x12, 0x04, 0xea, 0x06, 0x01, 0x8f, 0x27, 0x02, 0xb0,
+	0x07, 0x02, 0x25, 0x01, 0x02, 0xfd, 0x00, 0x07, 0xb6, 0x0b, 0x09, 0x12,
+	0x15, 0x06, 0x5c, 0x01, 0x21, 0x0a, 0x09, 0xb1, 0x01, 0x00, 0x35, 0x11,
+	0x06, 0x70, 0x01, 0x14, 0x2a, 0x2f, 0x23, 0x06, 0x71, 0x01, 0x09, 0x0f,
+	0x02, 0x0f, 0x6d, 0x10, 0x08, 0x0f, 0x6c, 0x10, 0x08, 0x03, 0x27, 0x02,
+	0x0e, 0xaf, 0x13, 0x0f, 0x69, 0x10, 0x11, 0x1f, 0x09, 0xc0, 0x0f, 0x04,
+	0x2f, 0x3b, 0x0a, 0x9d, 0x19, 0x0a, 0x0f, 0xa8, 0x12, 0x09, 0x03, 0xe7,
+	0x08, 0x22, 0x65, 0x64, 0x6c, 0x01, 0x72, 0x69, 0x73, 0x20, 0x6c, 0x65,
+	0x73, 0x73, 0x87, 0x12, 0x54, 0x31, 0x2f, 0x34, 0x20, 0x6f, 0xd2, 0x05,
+	0x00, 0x04, 0x13, 0x02, 0xaa, 0x21, 0x05, 0xdb, 0x05, 0x00, 0x12, 0x13,
+	0x05, 0x56, 0x20, 0x0e, 0x8e, 0x0b, 0x0f, 0x14, 0x11, 0x03, 0x59, 0x2f,
+	0x2a, 0x20, 0x4e, 0x6f, 0x26, 0x06, 0x11, 0x2e, 0x6a, 0x02, 0x0c, 0xac,
+	0x08, 0x06, 0x35, 0x05, 0x0f, 0xa5, 0x02, 0x01, 0x0b, 0xa2, 0x08, 0x06,
+	0x9c, 0x04, 0x07, 0x0b, 0x11, 0x41, 0x09, 0x65, 0x6c, 0x73, 0xe4, 0x00,
+	0x12, 0x28, 0xef, 0x16, 0x1b, 0x3d, 0x21, 0x14, 0x00, 0xee, 0x20, 0x04,
+	0x1a, 0x00, 0x0f, 0xeb, 0x13, 0x02, 0x40, 0x20, 0x2f, 0x20, 0x34, 0x74,
+	0x00, 0x0f, 0x13, 0x09, 0x06, 0x07, 0x6d, 0x00, 0x02, 0x40, 0x1f, 0x00,
+	0xd5, 0x00, 0x40, 0x62, 0x61, 0x63, 0x6b, 0xfd, 0x05, 0x09, 0x79, 0x09,
+	0x06, 0x1f, 0x22, 0x06, 0xd8, 0x00, 0x09, 0xdb, 0x06, 0x0e, 0x64, 0x00,
+	0x0f, 0xd5, 0x00, 0x03, 0x0b, 0xae, 0x18, 0x0f, 0x85, 0x02, 0x0f, 0x0e,
+	0x2b, 0x1a, 0x0f, 0x86, 0x02, 0x02, 0x0f, 0x59, 0x08, 0x0d, 0x01, 0xe0,
+	0x00, 0x10, 0x4d, 0xe0, 0x06, 0x08, 0x30, 0x0b, 0x28, 0x65, 0x72, 0xf9,
+	0x22, 0x33, 0x20, 0x61, 0x72, 0xae, 0x03, 0x51, 0x61, 0x20, 0x6c, 0x6f,
+	0x74, 0x60, 0x23, 0x32, 0x72, 0x65, 0x66, 0xb6, 0x23, 0x23, 0x72, 0x79,
+	0xe0, 0x14, 0x0b, 0x6b, 0x0b, 0x01, 0x16, 0x1a, 0x0f, 0x1e, 0x08, 0x07,
+	0x06, 0x85, 0x09, 0x2f, 0x69, 0x64, 0x15, 0x08, 0x02, 0x0f, 0x36, 0x00,
+	0x08, 0x02, 0x3b, 0x01, 0x0f, 0x35, 0x01, 0x25, 0x3f, 0x5f, 0x6f, 0x72,
+	0xc2, 0x03, 0x07, 0x0f, 0x2c, 0x14, 0x12, 0x0f, 0x4f, 0x01, 0x0a, 0x03,
+	0xb7, 0x00, 0x0b, 0x0a, 0x09, 0x0b, 0xe7, 0x00, 0x1d, 0x21, 0xf9, 0x02,
+	0x1f, 0x65, 0x10, 0x14, 0x05, 0x04, 0x3e, 0x00, 0x09, 0x0a, 0x14, 0x06,
+	0xc8, 0x29, 0x0f, 0x2f, 0x19, 0x11, 0x05, 0x96, 0x12, 0x0e, 0x65, 0x03,
+	0x02, 0x16, 0x09, 0x06, 0x29, 0x2a, 0x05, 0x3b, 0x19, 0x0f, 0x3a, 0x19,
+	0x07, 0x03, 0x64, 0x02, 0x0f, 0x6e, 0x00, 0x0f, 0x0e, 0xd5, 0x04, 0x0c,
+	0x9b, 0x0a, 0x0e, 0x77, 0x13, 0x01, 0x5b, 0x00, 0x04, 0x90, 0x00, 0x06,
+	0x03, 0x0c, 0x0e, 0x6c, 0x15, 0x0e, 0x44, 0x15, 0x0f, 0x18, 0x0a, 0x00,
+	0x06, 0xd8, 0x00, 0x06, 0xd0, 0x01, 0x05, 0x34, 0x01, 0x2f, 0x69, 0x64,
+	0x32, 0x01, 0x17, 0x03, 0x23, 0x17, 0x29, 0x69, 0x64, 0x31, 0x08, 0x02,
+	0x48, 0x00, 0x6f, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x27, 0x01, 0x27,
+	0x0f, 0x11, 0x06, 0x00, 0x0f, 0x3c, 0x01, 0x4d, 0x2f, 0x2d, 0x31, 0xdd,
+	0x16, 0x04, 0x0f, 0xbd, 0x16, 0x11, 0x06, 0xa9, 0x21, 0x02, 0xcb, 0x00,
+	0x1f, 0x21, 0x21, 0x08, 0x01, 0x0f, 0x4f, 0x0c, 0x02, 0x01, 0x47, 0x26,
+	0x02, 0x2f, 0x01, 0x0f, 0xbf, 0x27, 0x08, 0x06, 0x20, 0x06, 0x0d, 0x74,
+	0x1a, 0x1f, 0x31, 0x32, 0x0a, 0x01, 0x07, 0x24, 0x00, 0x2f, 0x2d, 0x2d,
+	0x62, 0x1c, 0x05, 0x06, 0xff, 0x2a, 0x01, 0x78, 0x24, 0x05, 0xdf, 0x0f,
+	0x0f, 0x39, 0x17, 0x0c, 0x30, 0x63, 0x68, 0x61, 0x12, 0x00, 0x10, 0x6e,
+	0xd8, 0x32, 0x2f, 0x2c, 0x0a, 0xfb, 0x15, 0x02, 0x82, 0x6c, 0x6f, 0x6f,
+	0x6b, 0x75, 0x70, 0x20, 0x2a, 0x08, 0x00, 0x0f, 0x59, 0x18, 0x13, 0x07,
+	0x89, 0x1f, 0x04, 0x0b, 0x00, 0x1f, 0x6a, 0xb3, 0x01, 0x0b, 0x0f, 0xb0,
+	0x01, 0x04, 0x0f, 0x00, 0x22, 0x1a, 0x08, 0xd3, 0x00, 0x37, 0x6e, 0x61,
+	0x6d, 0xca, 0x1f, 0x0f, 0x03, 0x22, 0x1d, 0x01, 0x73, 0x00, 0x12, 0x6a,
+	0x73, 0x00, 0x32, 0x6a, 0x20, 0x3c, 0x7a, 0x2c, 0x24, 0x20, 0x6a, 0x69,
+	0x00, 0x03, 0xc5, 0x22, 0x00, 0x10, 0x01, 0x20, 0x5b, 0x6a, 0xbc, 0x1f,
+	0x00, 0xd0, 0x00, 0x01, 0x97, 0x2c, 0x03, 0x20, 0x00, 0x13, 0x09, 0x7f,
+	0x00, 0x06, 0x24, 0x00, 0x00, 0x11, 0x00, 0x00, 0x89, 0x00, 0x06, 0xc1,
+	0x1f, 0x51, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0xfd, 0x0c, 0x0f, 0x2b, 0x26,
+	0x02, 0x52, 0x25, 0x73, 0x22, 0x2c, 0x20, 0x99, 0x01, 0x15, 0x29, 0x97,
+	0x22, 0x02, 0x57, 0x00, 0x06, 0x43, 0x06, 0x0f, 0x3a, 0x00, 0x03, 0x83,
+	0x30, 0x38, 0x78, 0x20, 0x20, 0x20, 0x22, 0x2c, 0x93, 0x00, 0x01, 0x4c,
+	0x20, 0x5f, 0x6c, 0x73, 0x65, 0x0a, 0x09, 0x6a, 0x00, 0x08, 0x00, 0x5a,
+	0x00, 0x2f, 0x29, 0x3b, 0x8c, 0x00, 0x05, 0x40, 0x32, 0x7a, 0x75, 0x2e,
+	0x51, 0x00, 0x1f, 0x69, 0x23, 0x00, 0x07, 0x11, 0x70, 0x20, 0x00, 0x0f,
+	0xbd, 0x0e, 0x02, 0x0f, 0x35, 0x00, 0x06, 0x71, 0x30, 0x78, 0x25, 0x30,
+	0x38, 0x7a, 0x78, 0xfc, 0x26, 0x0e, 0xca, 0x0e, 0x11, 0x29, 0x1c, 0x0e,
+	0x07, 0x8f, 0x04, 0x0e, 0xda, 0x02, 0x0f, 0x90, 0x04, 0x11, 0x0b, 0xc0,
+	0x02, 0x1f, 0x0a, 0xb3, 0x0a, 0x00, 0x06, 0xe2, 0x0e, 0x09, 0x6d, 0x0c,
+	0x0f, 0x59, 0x04, 0x06, 0x0f, 0x68, 0x03, 0x00, 0x06, 0xb9, 0x07, 0x48,
+	0x22, 0x22, 0x2c, 0x20, 0x2c, 0x03, 0x2f, 0x29, 0x3b, 0x61, 0x00, 0x03,
+	0x03, 0x40, 0x0f, 0x01, 0x27, 0x07, 0x01, 0x36, 0x02, 0x0f, 0x31, 0x28,
+	0x04, 0x09, 0x76, 0x08, 0x42, 0x3a, 0x5c, 0x6e, 0x22, 0x33, 0x24, 0x0f,
+	0x83, 0x00, 0x05, 0x00, 0x72, 0x08, 0x3e, 0x22, 0x20, 0x20, 0x85, 0x00,
+	0x0f, 0x68, 0x0f, 0x07, 0x53, 0x63, 0x75, 0x72, 0x73, 0x6f, 0xce, 0x18,
+	0x0f, 0x0d, 0x07, 0x04, 0x07, 0x50, 0x01, 0x02, 0x2e, 0x00, 0x22, 0x20,
+	0x2a, 0x08, 0x00, 0x08, 0x40, 0x01, 0x04, 0x30, 0x01, 0x00, 0xa0, 0x0a,
+	0x03, 0x26, 0x00, 0x0f, 0x9b, 0x05, 0x05, 0x03, 0x47, 0x2a, 0x02, 0x26,
+	0x00, 0x09, 0x4c, 0x2a, 0x03, 0x57, 0x00, 0x01, 0xf4, 0x02, 0x02, 0x0c,
+	0x00, 0x20, 0x2d, 0x3e, 0xed, 0x00, 0x3a, 0x5b, 0x30, 0x5d, 0xec, 0x11,
+	0x09, 0x1d, 0x00, 0x16, 0x31, 0x1d, 0x00, 0x2f, 0x73, 0x6d, 0xf2, 0x0c,
+	0x1a, 0x03, 0xfd, 0x00, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x28, 0xe6, 0x00,
+	0x06, 0x0f, 0xc8, 0x06, 0x17, 0x09, 0x2b, 0x09, 0x00, 0x18, 0x01, 0x04,
+	0xa7, 0x00, 0x71, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0xca, 0x06,
+	0x00, 0xb5, 0x25, 0xb8, 0x41, 0x52, 0x52, 0x41, 0x59, 0x5f, 0x53, 0x49,
+	0x5a, 0x45, 0x28, 0xca, 0x00, 0x0f, 0x46, 0x1d, 0x02, 0x09, 0x18, 0x05,
+	0x09, 0xf8, 0x00, 0x0f, 0x5e, 0x00, 0x01, 0x1f, 0x5d, 0xc3, 0x1d, 0x16,
+	0x0c, 0x3e, 0x00, 0x02, 0xbc, 0x00, 0x0e, 0x7b, 0x1c, 0x01, 0x9f, 0x02,
+	0x00, 0xdc, 0x0e, 0x30, 0x72, 0x79, 0x20, 0x29, 0x01, 0x01, 0x8e, 0x00,
+	0x02, 0xfb, 0x0a, 0x1f, 0x09, 0x82, 0x00, 0x01, 0x00, 0x1c, 0x1f, 0x2f,
+	0x09, 0x09, 0x5e, 0x00, 0x03, 0x01, 0xd5, 0x27, 0x05, 0x01, 0x12, 0x0c,
+	0x82, 0x01, 0x03, 0x6f, 0x01, 0x03, 0xae, 0x02, 0x0c, 0x90, 0x2b, 0x0f,
+	0x52, 0x00, 0x02, 0x00, 0x36, 0x1d, 0x0f, 0x6b, 0x00, 0x02, 0x02, 0xa2,
+	0x1f, 0xc0, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x65, 0x3b, 0x0a,
+	0x7d, 0x0a, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t compression_data_lzma[] = {
+	0x01, 0x00, 0x40, 0x00, 0x00, 0xcf, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x17, 0x8b, 0x58, 0xc7, 0x32, 0x65, 0xc0, 0x27, 0x18, 0x2b,
+	0xe6, 0x0e, 0xd9, 0x81, 0x74, 0x9f, 0x31, 0x6f, 0xe3, 0xdc, 0xf2, 0x2e,
+	0x76, 0x7f, 0x3c, 0xbc, 0xda, 0xc6, 0xd7, 0xc7, 0x1f, 0x59, 0x7a, 0x69,
+	0x61, 0x73, 0x73, 0xb3, 0x6b, 0x0a, 0x53, 0x30, 0x36, 0xf9, 0x68, 0xb8,
+	0xf9, 0x95, 0x29, 0x12, 0x8a, 0x6d, 0xe6, 0x93, 0x0a, 0x8f, 0x48, 0xe4,
+	0x4e, 0xcd, 0x1f, 0xe7, 0xa6, 0x7f, 0xf9, 0x7c, 0xc6, 0x28, 0x97, 0x65,
+	0x3e, 0x0b, 0xad, 0x54, 0xd8, 0xf8, 0xfe, 0x21, 0xeb, 0xf0, 0x18, 0x61,
+	0x02, 0xfe, 0xb7, 0xe7, 0xc0, 0xc6, 0xb8, 0x1d, 0xf4, 0x3c, 0x49, 0xc0,
+	0xb6, 0x08, 0xcf, 0x61, 0xa6, 0x60, 0x84, 0x32, 0xec, 0xf0, 0xe9, 0x9b,
+	0x02, 0xd5, 0x91, 0xa4, 0x56, 0x01, 0x5b, 0xc9, 0xb4, 0xd5, 0x96, 0xb9,
+	0x63, 0x73, 0xe5, 0xf1, 0xaa, 0x6d, 0xd9, 0xbb, 0x0f, 0x67, 0xa1, 0xb8,
+	0x08, 0x5d, 0x59, 0x13, 0x9c, 0x92, 0x55, 0xd1, 0xc9, 0x3f, 0x82, 0x6a,
+	0x5f, 0x21, 0x34, 0x35, 0x4a, 0x0b, 0x9d, 0x61, 0xc8, 0x12, 0x0f, 0x3c,
+	0xcc, 0xd1, 0x16, 0x27, 0x77, 0x71, 0xf8, 0x38, 0x76, 0x60, 0x39, 0x7d,
+	0xb7, 0x2b, 0x33, 0x6e, 0xfa, 0xe3, 0x78, 0x3f, 0xc7, 0x2a, 0x91, 0x84,
+	0x02, 0xda, 0xf8, 0x92, 0xb1, 0x3c, 0x6b, 0x50, 0xbd, 0x29, 0xe7, 0x85,
+	0xd4, 0x23, 0x6e, 0xc3, 0xcb, 0x0a, 0xb0, 0x8d, 0x96, 0xf9, 0x01, 0xcc,
+	0xc8, 0xce, 0x9d, 0x0f, 0x70, 0xdc, 0xe6, 0xfd, 0xcb, 0x88, 0x9c, 0x47,
+	0x78, 0x64, 0xc0, 0xae, 0x2f, 0xa9, 0xe1, 0xc6, 0x27, 0xe3, 0x69, 0x7b,
+	0x36, 0x04, 0x55, 0x14, 0x32, 0x1f, 0xc1, 0x2d, 0xa7, 0x1f, 0x5e, 0x7a,
+	0x0a, 0x90, 0xc6, 0x3d, 0x1d, 0xd5, 0x75, 0x46, 0x4d, 0x05, 0xbb, 0xa0,
+	0x3a, 0xf2, 0x68, 0x91, 0x65, 0x44, 0xad, 0x49, 0x32, 0x1b, 0x0e, 0xfc,
+	0xec, 0x9d, 0x0f, 0xc5, 0x44, 0x0c, 0x6d, 0xd8, 0xf2, 0xd3, 0x9c, 0xfa,
+	0x72, 0x6a, 0xe8, 0xb7, 0xb4, 0x75, 0x27, 0x11, 0x05, 0xac, 0x04, 0x4c,
+	0x65, 0x08, 0x31, 0x67, 0xee, 0xea, 0x3b, 0x98, 0x96, 0x02, 0x68, 0x92,
+	0xcc, 0xc3, 0x2f, 0x2c, 0x6a, 0xa3, 0xc9, 0x50, 0x39, 0xd5, 0x5d, 0xaa,
+	0xd4, 0x30, 0x6e, 0x0f, 0xcf, 0x86, 0x09, 0x1f, 0xde, 0x1e, 0x00, 0x70,
+	0x1b, 0x26, 0xd0, 0x45, 0xd3, 0x9f, 0x31, 0xf7, 0x73, 0xb2, 0x16, 0xd2,
+	0x69, 0x7c, 0x55, 0xe2, 0x39, 0x01, 0x26, 0x2e, 0x9d, 0x08, 0x16, 0x00,
+	0x5f, 0x73, 0x31, 0xc1, 0x37, 0x0f, 0x72, 0xd4, 0x73, 0xa3, 0x5e, 0x42,
+	0xa9, 0xe8, 0x4e, 0x97, 0xc5, 0xe2, 0xb2, 0xf2, 0x4f, 0xcd, 0x5f, 0xd9,
+	0x25, 0xf8, 0x4d, 0x90, 0xa9, 0x3f, 0x33, 0xa7, 0xd8, 0x08, 0x48, 0xfe,
+	0x40, 0x9b, 0xf3, 0x6f, 0x8b, 0x61, 0xa2, 0xea, 0xea, 0x7b, 0x55, 0xb0,
+	0x4c, 0xfe, 0x6a, 0xf7, 0x01, 0xb4, 0x4f, 0x4f, 0x8d, 0xc3, 0x5d, 0x7c,
+	0xfd, 0x8c, 0x23, 0xb6, 0x25, 0x2e, 0x3a, 0x4e, 0x8d, 0x22, 0xa0, 0xba,
+	0x91, 0x79, 0xae, 0x03, 0x60, 0xa9, 0x12, 0xf6, 0x12, 0x8e, 0x87, 0x5e,
+	0x9b, 0xa7, 0x98, 0xe7, 0x78, 0x70, 0xc7, 0x75, 0xd8, 0x53, 0x8a, 0x4e,
+	0x42, 0xce, 0xdf, 0x9f, 0x0b, 0x49, 0x97, 0xb3, 0xf8, 0x4c, 0x02, 0xcb,
+	0x11, 0xb9, 0xa8, 0xcc, 0xf2, 0xd0, 0xd4, 0x45, 0xce, 0x70, 0x81, 0x5a,
+	0xd3, 0xc5, 0x16, 0x1c, 0x91, 0xe4, 0xd3, 0x62, 0xbc, 0x17, 0x8b, 0xb1,
+	0x35, 0x9f, 0x45, 0xd0, 0xc6, 0xe0, 0xcf, 0x48, 0xb0, 0xcb, 0xa6, 0x6f,
+	0x7f, 0xbd, 0x96, 0x63, 0x69, 0xf9, 0xcf, 0x5a, 0x9e, 0x07, 0x4b, 0x0e,
+	0xf4, 0x27, 0xc6, 0xa1, 0x9c, 0x7e, 0xd0, 0x83, 0xc9, 0x42, 0x8e, 0xb5,
+	0x42, 0xfa, 0x79, 0x59, 0x87, 0x0e, 0xbe, 0x82, 0x8c, 0x08, 0xe6, 0x9c,
+	0xe9, 0x33, 0xb8, 0x36, 0x6c, 0x6f, 0x78, 0x22, 0xe3, 0x44, 0xfd, 0x48,
+	0x7d, 0xfe, 0x0a, 0x21, 0xdb, 0x4f, 0x9f, 0xf5, 0xda, 0x20, 0xeb, 0xcc,
+	0x83, 0x36, 0xa9, 0xbf, 0xc1, 0x4c, 0x25, 0x9b, 0xf1, 0x34, 0x85, 0xff,
+	0xe2, 0x4f, 0x63, 0xc3, 0xb6, 0xaa, 0xd6, 0x21, 0x60, 0x51, 0xcf, 0x63,
+	0xc5, 0xe4, 0x91, 0x57, 0xb3, 0x32, 0x1d, 0xea, 0xe6, 0xe7, 0x64, 0x4e,
+	0x41, 0x97, 0x22, 0xe3, 0xaa, 0xe7, 0xa2, 0x25, 0x15, 0xff, 0x2b, 0x17,
+	0xc6, 0xe4, 0x0c, 0xf1, 0xa8, 0xda, 0xa1, 0x12, 0x4f, 0x63, 0x36, 0x6e,
+	0xbc, 0x74, 0x50, 0xb5, 0x7a, 0x01, 0xd0, 0x86, 0x3c, 0x98, 0x33, 0xd7,
+	0xf5, 0xc7, 0xf1, 0x3d, 0x71, 0xfd, 0xd7, 0x29, 0x98, 0x82, 0x2f, 0x2f,
+	0x6f, 0x55, 0x62, 0x44, 0x82, 0x3a, 0xae, 0x67, 0x1d, 0xd3, 0x38, 0x5d,
+	0x9b, 0xec, 0x3d, 0x24, 0xa5, 0x3f, 0xef, 0xb0, 0xfc, 0x02, 0x37, 0xee,
+	0xed, 0xaa, 0x11, 0xd3, 0x04, 0x52, 0x57, 0x97, 0x86, 0x40, 0xf7, 0x0b,
+	0xbf, 0x5f, 0xf7, 0x3b, 0xe3, 0x89, 0x20, 0x3c, 0x10, 0xc5, 0xc2, 0x96,
+	0x4c, 0x3f, 0xe4, 0x31, 0xb2, 0x0b, 0xdc, 0x04, 0xd2, 0xb5, 0x3e, 0x20,
+	0xb1, 0x04, 0xc5, 0xb5, 0x6d, 0xa8, 0xbf, 0xa6, 0xdf, 0x62, 0x71, 0x9e,
+	0xcd, 0xa3, 0xff, 0x42, 0x2e, 0x12, 0xef, 0x71, 0x90, 0x76, 0x30, 0x3e,
+	0x6d, 0x3e, 0x2c, 0xf4, 0x23, 0xa0, 0x43, 0xfb, 0x85, 0x82, 0xd2, 0x0b,
+	0xcc, 0x64, 0x8d, 0xbd, 0x33, 0x79, 0x59, 0xf5, 0x17, 0xce, 0xd9, 0xd2,
+	0xf4, 0x26, 0x9d, 0xa6, 0x78, 0x79, 0xea, 0x82, 0x1e, 0x3a, 0x6c, 0x91,
+	0xed, 0xa5, 0x61, 0xee, 0x18, 0x6a, 0xe0, 0x89, 0x2f, 0x47, 0xc1, 0x09,
+	0x33, 0xee, 0x95, 0x28, 0x7b, 0x79, 0x58, 0x3d, 0xb6, 0x6b, 0x74, 0x7a,
+	0x2e, 0x4b, 0x03, 0x8a, 0xc5, 0x98, 0x2c, 0x6c, 0xa1, 0x1a, 0x30, 0xda,
+	0x5b, 0x18, 0x74, 0x72, 0x34, 0xc3, 0x02, 0x50, 0xe2, 0x76, 0x27, 0x64,
+	0xc2, 0x79, 0x25, 0x22, 0x1d, 0x70, 0x97, 0x41, 0x01, 0xa4, 0x85, 0x4a,
+	0xcd, 0x7e, 0xe2, 0x1a, 0x0a, 0xd1, 0xf8, 0x52, 0x5a, 0x3b, 0x49, 0x5b,
+	0x2b, 0x34, 0xa4, 0x24, 0x18, 0xb8, 0xe6, 0x38, 0xfa, 0xed, 0xfd, 0x2b,
+	0xff, 0xf5, 0x58, 0x31, 0x86, 0x91, 0xf0, 0xa3, 0xd7, 0xfb, 0xdf, 0x6e,
+	0x07, 0xe7, 0x0e, 0xf5, 0xf7, 0x96, 0xe2, 0x8f, 0x47, 0x1a, 0xa6, 0x1a,
+	0x96, 0x69, 0xcb, 0xff, 0x0c, 0xd9, 0xb4, 0x26, 0x2b, 0x78, 0x74, 0x0f,
+	0x15, 0x4b, 0x62, 0xe7, 0xbb, 0xb5, 0xd2, 0x6b, 0x39, 0xf5, 0xdf, 0x5f,
+	0x50, 0x7c, 0x73, 0x6c, 0x60, 0x09, 0xaf, 0x46, 0xcc, 0x0d, 0x12, 0xb6,
+	0x2d, 0x65, 0x7e, 0x6b, 0x7c, 0xa4, 0xc4, 0xce, 0xc6, 0xd7, 0x20, 0xbf,
+	0x34, 0x2b, 0x94, 0x15, 0x21, 0xe5, 0x8e, 0x9d, 0x73, 0x51, 0x88, 0xce,
+	0xfc, 0x35, 0xb2, 0xaa, 0xd4, 0x67, 0xf5, 0x5a, 0x48, 0xa0, 0xf9, 0x10,
+	0xcc, 0x4f, 0xeb, 0x5e, 0x3e, 0x9c, 0x04, 0x99, 0xc4, 0xa8, 0x28, 0x70,
+	0xb7, 0x50, 0x5e, 0x62, 0x9b, 0x78, 0x35, 0x66, 0xac, 0x03, 0x37, 0x36,
+	0xf9, 0x30, 0x33, 0x2d, 0xa5, 0xe6, 0xaa, 0xad, 0x9d, 0x07, 0xfd, 0xe4,
+	0x18, 0x99, 0xa8, 0x84, 0xc9, 0xfd, 0x2e, 0xd4, 0x56, 0x0e, 0x33, 0xa4,
+	0x4a, 0x5d, 0x4d, 0x72, 0x6d, 0x19, 0x91, 0xa5, 0x9c, 0xaf, 0xa2, 0xb6,
+	0x53, 0xfd, 0x0a, 0xb9, 0xaf, 0x29, 0xb4, 0xc7, 0x84, 0x32, 0xd5, 0x5a,
+	0x54, 0x90, 0xd1, 0x32, 0x4b, 0x7b, 0x0c, 0x5c, 0x28, 0xdd, 0x1a, 0x07,
+	0x95, 0x3e, 0x2e, 0x79, 0xb9, 0xbb, 0xa5, 0xe0, 0xd7, 0x76, 0x44, 0x57,
+	0x81, 0xa7, 0x37, 0x55, 0x69, 0x8a, 0x14, 0x84, 0xde, 0x16, 0x88, 0xe3,
+	0xf6, 0x8f, 0x44, 0x6c, 0x17, 0xb7, 0x0e, 0xa9, 0x38, 0x93, 0x95, 0x66,
+	0x14, 0x48, 0xb4, 0x31, 0xa9, 0x20, 0x93, 0x69, 0x12, 0xb9, 0x27, 0xa5,
+	0xd3, 0x60, 0x51, 0x54, 0xf2, 0x6a, 0x6c, 0xfa, 0x01, 0x96, 0x89, 0xdd,
+	0x73, 0x6d, 0x5f, 0x69, 0x35, 0xbb, 0x45, 0xaf, 0xa0, 0x37, 0x6c, 0x28,
+	0x8a, 0x85, 0x7d, 0x74, 0x0a, 0x4c, 0x89, 0x86, 0x09, 0x66, 0xcf, 0xef,
+	0x24, 0xc7, 0xfe, 0xc1, 0x78, 0xab, 0x75, 0x9b, 0xae, 0xc3, 0xe1, 0xbb,
+	0x53, 0x4a, 0x43, 0x65, 0x30, 0x82, 0xe6, 0xac, 0x90, 0x0b, 0x42, 0x9a,
+	0xff, 0xe7, 0x04, 0xeb, 0x5e, 0xe0, 0x90, 0xd3, 0xcd, 0x74, 0x55, 0xff,
+	0x38, 0x3b, 0x89, 0xb2, 0xf4, 0x88, 0xa6, 0xfc, 0x84, 0xe6, 0xdf, 0x9d,
+	0xa1, 0xf3, 0xb0, 0x98, 0x5e, 0x5a, 0xb4, 0x73, 0x6b, 0xb9, 0x60, 0xf8,
+	0x11, 0xd8, 0x89, 0x8f, 0x2f, 0x0c, 0xd2, 0x35, 0x6f, 0x73, 0xd8, 0x58,
+	0x84, 0x2d, 0x0a, 0xb2, 0x5f, 0x60, 0xcd, 0x02, 0x3a, 0x4f, 0x88, 0x28,
+	0x3c, 0x4e, 0x7f, 0xd1, 0xe0, 0x3a, 0x1e, 0x76, 0x40, 0x8b, 0x06, 0xc5,
+	0x56, 0x73, 0x1f, 0xb0, 0x79, 0x12, 0xc5, 0x41, 0x84, 0xb4, 0x13, 0xd7,
+	0xf7, 0xbb, 0x49, 0x2d, 0x43, 0xd3, 0x69, 0xc8, 0xdd, 0x18, 0xe1, 0x1a,
+	0xce, 0xb4, 0x96, 0x9f, 0x01, 0x77, 0xa1, 0xd6, 0x73, 0xb4, 0xdb, 0xc3,
+	0x34, 0x10, 0x9e, 0x2c, 0xca, 0xb7, 0xc4, 0x78, 0xfd, 0x97, 0xab, 0x8f,
+	0x3a, 0x29, 0x2f, 0x70, 0x89, 0x2c, 0x5e, 0x83, 0xd0, 0xa0, 0x76, 0xeb,
+	0x48, 0xd1, 0x6b, 0x4b, 0x3e, 0x9e, 0x70, 0x37, 0xe4, 0x94, 0x00, 0x6c,
+	0xca, 0xb0, 0x33, 0x58, 0x11, 0xc2, 0xc9, 0x7c, 0xbb, 0x97, 0xb7, 0x05,
+	0x1e, 0x6e, 0x27, 0xa8, 0xb5, 0x99, 0xd6, 0x9b, 0x9a, 0x19, 0x11, 0xdc,
+	0x9c, 0x9c, 0xd1, 0x60, 0xe2, 0x8b, 0x08, 0xe3, 0xcd, 0x57, 0xac, 0xc0,
+	0x37, 0x26, 0xcf, 0x06, 0x5b, 0x62, 0x9d, 0xda, 0x46, 0xb9, 0x60, 0xe3,
+	0x6d, 0xc4, 0x07, 0x8f, 0x6a, 0x57, 0x13, 0xff, 0x35, 0xdd, 0x62, 0xbd,
+	0x19, 0x30, 0xeb, 0xd9, 0x32, 0x1e, 0x11, 0x65, 0x94, 0x85, 0x79, 0x55,
+	0xb6, 0x19, 0x8d, 0xde, 0xf1, 0xe8, 0xe1, 0xc6, 0x27, 0x2b, 0x02, 0x8b,
+	0x44, 0x8d, 0x93, 0xbd, 0x6d, 0x62, 0xde, 0xae, 0x19, 0x8b, 0x1b, 0x6e,
+	0xda, 0xb0, 0xbe, 0x28, 0x36, 0xe4, 0x89, 0x85, 0xe3, 0x8f, 0x44, 0xa3,
+	0x1f, 0x40, 0xf7, 0x7f, 0x4e, 0xaf, 0x74, 0xba, 0x92, 0x08, 0x4f, 0x16,
+	0x3f, 0x9a, 0xf7, 0x55, 0x10, 0x34, 0x16, 0xfe, 0x64, 0xef, 0x7f, 0x93,
+	0xaf, 0x00, 0x76, 0x38, 0x20, 0xdd, 0xbc, 0xbb, 0x9c, 0xb3, 0xa5, 0x4b,
+	0x8b, 0x87, 0xb8, 0x2c, 0x67, 0x09, 0xf0, 0xeb, 0x57, 0x14, 0xd0, 0xc0,
+	0xe9, 0xbe, 0x1f, 0x3a, 0xf7, 0x0a, 0x99, 0x34, 0x67, 0x9d, 0x4f, 0x5c,
+	0x29, 0xc3, 0x8c, 0x3e, 0xa7, 0x1f, 0x23, 0x1d, 0x6b, 0x3b, 0x3e, 0xc9,
+	0x79, 0x93, 0xde, 0x49, 0xc0, 0x1f, 0x56, 0xfb, 0xeb, 0x76, 0x0b, 0xd8,
+	0x02, 0x66, 0xa1, 0xe5, 0x59, 0xdc, 0xa1, 0xee, 0x8d, 0xd5, 0x5e, 0x77,
+	0x8f, 0xc7, 0xfe, 0x92, 0x73, 0xf9, 0x2b, 0xdb, 0xf4, 0xea, 0x93, 0x1f,
+	0x15, 0x60, 0xc0, 0x51, 0x33, 0xf7, 0xbd, 0x05, 0x9b, 0x01, 0x38, 0x06,
+	0x54, 0xa4, 0xcc, 0xf9, 0x37, 0xb0, 0x7a, 0x19, 0xa1, 0xb6, 0xe8, 0x8d,
+	0xc6, 0x8a, 0xa1, 0xae, 0x40, 0x64, 0x56, 0xde, 0xc9, 0xbc, 0x52, 0x7d,
+	0xd7, 0xcc, 0x05, 0x54, 0xef, 0x1f, 0x8a, 0x49, 0x73, 0x99, 0x98, 0x0e,
+	0x05, 0x0f, 0xde, 0xcd, 0x01, 0xd6, 0xa5, 0x71, 0xfa, 0xff, 0xba, 0x46,
+	0x4e, 0xae, 0x2b, 0xc7, 0x8a, 0x63, 0xcd, 0x84, 0x6b, 0x5c, 0xcf, 0x1b,
+	0x60, 0x9a, 0x96, 0x98, 0xe8, 0xd1, 0x09, 0xd8, 0x4e, 0xc5, 0xf0, 0x4b,
+	0x3f, 0xdb, 0x31, 0x4b, 0x63, 0x40, 0xfa, 0x48, 0xd5, 0xe0, 0x10, 0x40,
+	0x44, 0x50, 0x2e, 0x1b, 0x9f, 0x55, 0x05, 0xd0, 0xb3, 0x73, 0xdb, 0xf9,
+	0x17, 0xef, 0x59, 0x4b, 0xe4, 0xab, 0x1e, 0x34, 0x6d, 0x48, 0xf5, 0x09,
+	0x5f, 0x59, 0x89, 0xde, 0xf2, 0x62, 0xe6, 0xee, 0x30, 0xaa, 0x95, 0x51,
+	0x4a, 0x59, 0x23, 0xef, 0x7b, 0x8b, 0xe5, 0x76, 0xcf, 0x74, 0x2e, 0x18,
+	0xd9, 0x0b, 0x5d, 0x89, 0x2e, 0x77, 0x36, 0x63, 0xa8, 0x32, 0xe8, 0x97,
+	0x62, 0x5a, 0x85, 0x27, 0x64, 0xb3, 0x7f, 0x29, 0x4b, 0x74, 0x04, 0x33,
+	0x18, 0x19, 0xbe, 0x1e, 0x4a, 0x16, 0xa9, 0x4d, 0x90, 0xf2, 0x1b, 0x1d,
+	0xfd, 0x05, 0xc7, 0x4b, 0x50, 0x0f, 0xec, 0xda, 0x95, 0xe0, 0x59, 0x84,
+	0x5c, 0x44, 0x5f, 0x44, 0x24, 0x3f, 0xbb, 0x76, 0xd0, 0xb7, 0xf2, 0xd1,
+	0xca, 0x1d, 0xe5, 0x9e, 0x26, 0x49, 0x65, 0xf8, 0xd5, 0x9e, 0x51, 0xad,
+	0xe3, 0x23, 0x6f, 0xad, 0x91, 0xfe, 0xbe, 0x91, 0x0e, 0x8a, 0x51, 0x4a,
+	0x5e, 0xa4, 0xbf, 0xf5, 0xa7, 0xaf, 0x46, 0xeb, 0x4b, 0x86, 0xfa, 0x42,
+	0x11, 0x8d, 0xa9, 0xb7, 0x81, 0xdf, 0x90, 0x88, 0x70, 0x2c, 0x4c, 0x17,
+	0x60, 0x65, 0xb5, 0xda, 0xc0, 0x70, 0x71, 0xb2, 0xa5, 0x92, 0x88, 0x49,
+	0x5d, 0x74, 0x90, 0xf9, 0x78, 0x95, 0xd4, 0x39, 0x9e, 0x87, 0xcf, 0x43,
+	0xc6, 0xdf, 0x5e, 0x99, 0x6a, 0x44, 0xba, 0x5e, 0xd7, 0xc2, 0x74, 0xf8,
+	0x0f, 0x78, 0x55, 0xbe, 0x1b, 0x25, 0xb7, 0x93, 0xfa, 0x70, 0x2f, 0xe6,
+	0x07, 0x8d, 0xd1, 0x31, 0x72, 0x8f, 0xb8, 0x56, 0x2a, 0x8c, 0xd8, 0x0a,
+	0xb8, 0x95, 0x48, 0xdb, 0xee, 0x29, 0x7d, 0x77, 0x0c, 0x26, 0x45, 0x8b,
+	0x14, 0xfc, 0x5c, 0x85, 0x54, 0x08, 0x01, 0x65, 0x36, 0x83, 0xff, 0xe3,
+	0x43, 0xc0, 0x53, 0x48, 0xd5, 0x29, 0x07, 0x49, 0x8d, 0x23, 0xa9, 0x40,
+	0xc8, 0x5e, 0xd1, 0x91, 0xcf, 0x42, 0x84, 0x38, 0x9d, 0x9d, 0xb5, 0x0d,
+	0xbb, 0xf0, 0x19, 0xaa, 0xc0, 0x93, 0xe7, 0xe7, 0xe9, 0x0a, 0xdd, 0x85,
+	0xfe, 0x6f, 0x11, 0x80, 0xe1, 0x3a, 0x4b, 0x9f, 0x0d, 0xd5, 0xae, 0xb3,
+	0xc0, 0x31, 0x02, 0xf8, 0xb7, 0x0a, 0x7f, 0xd9, 0x22, 0xd5, 0xa7, 0x1e,
+	0x62, 0x0a, 0xb1, 0x96, 0x45, 0x40, 0xb3, 0xd1, 0xf4, 0xe7, 0xcf, 0xd7,
+	0xae, 0x11, 0x27, 0x45, 0xbd, 0x4a, 0xa1, 0x3c, 0x97, 0xba, 0x32, 0xdc,
+	0x3c, 0xae, 0x95, 0xe6, 0xa8, 0xf7, 0x94, 0xd5, 0xb9, 0xbe, 0x9b, 0xe6,
+	0x7b, 0xc7, 0x24, 0xab, 0x90, 0xe4, 0xec, 0x5f, 0x39, 0xac, 0xa5, 0x38,
+	0xd4, 0xe4, 0x2d, 0x6c, 0xf4, 0x9c, 0xce, 0xe6, 0x56, 0x66, 0x78, 0xaf,
+	0xcc, 0xfb, 0x92, 0x7b, 0x56, 0x9e, 0x50, 0x0e, 0xe4, 0x6c, 0xd2, 0x31,
+	0xd2, 0xc0, 0xa1, 0xce, 0x80, 0x91, 0x9b, 0xe4, 0x16, 0xa2, 0x52, 0xd2,
+	0x66, 0xf4, 0x8c, 0x47, 0x2a, 0x21, 0x14, 0xb2, 0xc7, 0x31, 0xed, 0x56,
+	0xea, 0x43, 0x68, 0x56, 0xa3, 0x94, 0xb6, 0x7c, 0x54, 0x93, 0x05, 0xcb,
+	0x80, 0x30, 0x99, 0xa9, 0xa1, 0x37, 0xd0, 0x4c, 0xc9, 0x85, 0x5b, 0x5c,
+	0xb1, 0x37, 0xbd, 0x5c, 0x69, 0x11, 0x0d, 0xea, 0xb4, 0x8a, 0x09, 0xd1,
+	0xf7, 0x28, 0x4f, 0xa6, 0x35, 0x86, 0xb3, 0x86, 0x21, 0x00, 0xb0, 0x61,
+	0x48, 0x89, 0xa1, 0x6e, 0x2b, 0xe4, 0x21, 0xcd, 0x8a, 0xf1, 0x7a, 0x9e,
+	0xa5, 0x03, 0x08, 0x02, 0xbe, 0x46, 0x0d, 0xac, 0xad, 0x27, 0x3a, 0xff,
+	0xf9, 0xde, 0x05, 0x1c, 0x5f, 0xad, 0x5c, 0x22, 0x1d, 0x85, 0x05, 0x01,
+	0x33, 0x0e, 0xc2, 0xa5, 0xf8, 0xda, 0xe3, 0xf3, 0x80, 0xc0, 0xc1, 0x10,
+	0x84, 0x2f, 0x8b, 0xdf, 0x77, 0x62, 0x66, 0x46, 0xd2, 0x87, 0x24, 0xa9,
+	0x34, 0x68, 0x57, 0x08, 0x6d, 0x30, 0xe8, 0xb5, 0xc3, 0x6c, 0xa3, 0x83,
+	0x6f, 0x83, 0x1b, 0x78, 0x92, 0x99, 0xf2, 0xc0, 0x7c, 0xe6, 0xec, 0x3b,
+	0xd2, 0x53, 0xd4, 0xc7, 0xdc, 0x4a, 0xb3, 0x06, 0x2f, 0xaf, 0x17, 0x3f,
+	0x84, 0xbd, 0xd1, 0x83, 0xf6, 0x92, 0xf6, 0x50, 0x06, 0xba, 0x60, 0x96,
+	0x68, 0x40, 0xf3, 0x18, 0x7c, 0x75, 0xae, 0x34, 0xae, 0x3f, 0xad, 0xb0,
+	0x4b, 0x25, 0x68, 0xa4, 0x6a, 0x3e, 0xe8, 0x25, 0xec, 0x23, 0x10, 0xcb,
+	0x5e, 0x19, 0x40, 0x7b, 0x2a, 0x9f, 0xc7, 0x09, 0xba, 0x65, 0xe3, 0x74,
+	0x31, 0x0b, 0x1a, 0xd2, 0xb3, 0x51, 0xfd, 0x48, 0x48, 0x82, 0xc9, 0xb9,
+	0xbf, 0xa2, 0xf8, 0x21, 0x50, 0x2e, 0x9b, 0x6e, 0x9d, 0x59, 0xd6, 0x97,
+	0x9a, 0x64, 0xd0, 0xcc, 0x3a, 0x3d, 0x94, 0x92, 0x2e, 0x94, 0x6b, 0xbb,
+	0x70, 0xb2, 0xab, 0xc5, 0x11, 0x0a, 0xb5, 0x48, 0xd5, 0x72, 0x8e, 0xea,
+	0x6b, 0x67, 0x78, 0xfc, 0xc6, 0xc7, 0xb7, 0xc2, 0xdb, 0x04, 0x56, 0x86,
+	0x32, 0x19, 0x57, 0xfd, 0xd5, 0x02, 0xfe, 0x59, 0x5b, 0xbb, 0xb3, 0x87,
+	0xc8, 0x0a, 0xcf, 0xcb, 0x9a, 0x22, 0x57, 0x33, 0x5c, 0x21, 0x04, 0x46,
+	0xcd, 0x6d, 0xd6, 0xdf, 0x0f, 0x44, 0x60, 0x3b, 0x4c, 0xbe, 0x87, 0xeb,
+	0x71, 0x74, 0xb4, 0x53, 0x65, 0xaa, 0x76, 0x3e, 0x3d, 0x2c, 0x84, 0x94,
+	0x89, 0x92, 0xf0, 0xf5, 0x1c, 0xdc, 0xc2, 0x91, 0x27, 0x74, 0xdf, 0x92,
+	0x62, 0x7b, 0x36, 0x2b, 0x0f, 0x8a, 0x20, 0x37, 0xda, 0xb8, 0x2f, 0x6f,
+	0x82, 0xaa, 0x35, 0x8a, 0x8e, 0xa3, 0x69, 0xc5, 0x48, 0x9c, 0x37, 0x1d,
+	0x7b, 0x86, 0x18, 0xf7, 0x21, 0x6b, 0x75, 0xbd, 0x83, 0xee, 0x5a, 0x82,
+	0x55, 0xab, 0xb9, 0x89, 0x9e, 0xb2, 0x02, 0x76, 0x5b, 0xad, 0x5b, 0xa8,
+	0xba, 0xf4, 0x20, 0x48, 0x3c, 0x2f, 0xfc, 0xce, 0xc3, 0x59, 0x16, 0x23,
+	0x96, 0x0a, 0x2a, 0x0b, 0x1b, 0x3d, 0xd4, 0xc3, 0x32, 0xab, 0x61, 0x32,
+	0x53, 0x29, 0xe1, 0xe7, 0xbe, 0xf2, 0xa4, 0x47, 0xb1, 0x12, 0xe8, 0xa7,
+	0xa3, 0x04, 0xab, 0xce, 0xf1, 0xa6, 0x0f, 0xd7, 0x38, 0x47, 0xca, 0x99,
+	0xeb, 0xe3, 0xdf, 0x1b, 0x20, 0x93, 0xc0, 0x96, 0xbc, 0x24, 0x3b, 0xe4,
+	0x16, 0xef, 0x8e, 0x8b, 0x13, 0x41, 0x25, 0xc3, 0xf0, 0x35, 0x7f, 0x3e,
+	0xf9, 0x93, 0x01, 0xd3, 0x4c, 0x55, 0xe2, 0x81, 0x09, 0x98, 0x37, 0x14,
+	0xcc, 0xc2, 0xb7, 0x27, 0x04, 0xf1, 0x15, 0x6e, 0xa3, 0x64, 0xe1, 0x83,
+	0xce, 0x5e, 0x74, 0xe3, 0xd3, 0x7d, 0xd4, 0x91, 0x71, 0xbb, 0xa7, 0x6f,
+	0x5a, 0x14, 0x95, 0xc3, 0x39, 0x17, 0x97, 0x78, 0x5a, 0xa6, 0x64, 0x51,
+	0xd8, 0x63, 0x1e, 0xed, 0x59, 0x15, 0x81, 0x83, 0xc8, 0x95, 0xf5, 0x24,
+	0xbb, 0xa6, 0x17, 0x6f, 0xe0, 0x43, 0x9f, 0x3e, 0xbe, 0x4a, 0xf5, 0x13,
+	0xf2, 0xaa, 0x85, 0xdb, 0xf2, 0x8a, 0xf8, 0x18, 0x02, 0xd1, 0xde, 0x38,
+	0xd5, 0xea, 0x59, 0xe6, 0x26, 0x28, 0x60, 0xc1, 0x93, 0x3e, 0x2e, 0x06,
+	0x1f, 0x50, 0xe0, 0x44, 0x3c, 0x07, 0x7f, 0x4e, 0x0f, 0x54, 0xb8, 0xfe,
+	0xa4, 0x3e, 0x3a, 0x34, 0xb3, 0xd7, 0xa0, 0x44, 0x25, 0x54, 0x06, 0xb6,
+	0x50, 0xed, 0xbb, 0x1d, 0xd8, 0x1e, 0xfb, 0xb0, 0x12, 0x91, 0xca, 0xf1,
+	0x31, 0x41, 0x23, 0x85, 0x86, 0x7c, 0x42, 0xb0, 0xb2, 0xa2, 0x54, 0xd1,
+	0x0d, 0x6b, 0x98, 0x97, 0x82, 0x3e, 0xe6, 0x46, 0xee, 0x7e, 0x9c, 0x3b,
+	0xf0, 0x50, 0x03, 0xce, 0x10, 0x1a, 0x2b, 0x11, 0xf6, 0x77, 0x83, 0xa2,
+	0x87, 0x54, 0xdf, 0x2e, 0x46, 0x25, 0xe8, 0xbb, 0x76, 0xd3, 0x2c, 0x56,
+	0x48, 0xfa, 0x45, 0xf4, 0xdc, 0xdf, 0x82, 0x7f, 0x76, 0xf1, 0xf1, 0xc8,
+	0xd7, 0x06, 0xc1, 0x39, 0xf3, 0xd8, 0xed, 0x19, 0xf2, 0xac, 0xe0, 0xca,
+	0x87, 0xbc, 0x2f, 0x8e, 0xca, 0x35, 0x28, 0x67, 0x22, 0xe1, 0x67, 0x5e,
+	0x1f, 0x8d, 0xa5, 0xca, 0x02, 0x3b, 0xec, 0xd3, 0x69, 0x83, 0x7c, 0xca,
+	0x05, 0x3b, 0xcd, 0x6d, 0x39, 0x52, 0x1b, 0xaf, 0x18, 0xf8, 0xb4, 0xfe,
+	0x59, 0xcf, 0x09, 0x6b, 0x1c, 0xf1, 0x9e, 0x4b, 0xdc, 0x63, 0xe9, 0x63,
+	0xf3, 0xa3, 0xbf, 0xec, 0x41, 0x5b, 0x2b, 0x08, 0x43, 0x0d, 0xd0, 0xaf,
+	0x0e, 0x29, 0xb0, 0x6e, 0x4a, 0xe4, 0x3e, 0xee, 0x05, 0x27, 0xbb, 0xd0,
+	0xa0, 0xd2, 0x7a, 0x82, 0xaf, 0x50, 0x36, 0x9c, 0xb6, 0x67, 0x2c, 0xdd,
+	0x79, 0xbc, 0xcc, 0xf6, 0x41, 0xe0, 0x20, 0x34, 0x88, 0xb7, 0x4e, 0x1f,
+	0x09, 0x0b, 0xd3, 0x0b, 0x44, 0x24, 0x11, 0x6e, 0xb1, 0x5b, 0x61, 0xe2,
+	0xde, 0xc5, 0x5f, 0x36, 0x9b, 0x90, 0xd5, 0x77, 0x27, 0xfd, 0x01, 0x20,
+	0x3b, 0xdc, 0x0c, 0xe8, 0xe5, 0x1f, 0x92, 0x7f, 0x4c, 0x24, 0x7f, 0x40,
+	0x46, 0xe9, 0xb7, 0x4f, 0x27, 0x87, 0x57, 0xfe, 0x13, 0xfa, 0x4b, 0x85,
+	0x30, 0xb0, 0xc8, 0x6a, 0xf2, 0xc4, 0x6b, 0xe8, 0x64, 0xa2, 0x0c, 0xb7,
+	0xfd, 0xbf, 0xf2, 0x6e, 0xc0, 0x4b, 0xf9, 0x04, 0xac, 0xa0, 0x05, 0xed,
+	0xf8, 0x14, 0x7a, 0x8e, 0xcf, 0x20, 0x43, 0xc6, 0xf3, 0xb8, 0xb2, 0xc5,
+	0xed, 0x4f, 0x51, 0x2d, 0xe5, 0xcf, 0x06, 0x06, 0x29, 0xfb, 0x4a, 0x0d,
+	0x83, 0x02, 0xcf, 0xf6, 0xc3, 0xfc, 0x4c, 0x03, 0x01, 0x75, 0x71, 0x29,
+	0xab, 0x52, 0x0f, 0x2f, 0x17, 0xc6, 0xf4, 0x92, 0x3e, 0x7b, 0xab, 0xcc,
+	0xe8, 0x80, 0x48, 0x5b, 0x8c, 0x19, 0x7e, 0x4b, 0x45, 0x80, 0xb7, 0xb0,
+	0x8e, 0x00, 0xfb, 0x5c, 0xb7, 0x73, 0x6a, 0x4d, 0x07, 0x10, 0x08, 0xf9,
+	0x47, 0xd0, 0x96, 0xf5, 0x40, 0x8d, 0x3f, 0x40, 0x14, 0x61, 0x1e, 0x43,
+	0x78, 0x71, 0x55, 0xb5, 0x6d, 0x58, 0x6b, 0x58, 0x31, 0xd6, 0x08, 0x5b,
+	0xe5, 0x38, 0x9b, 0x7e, 0x02, 0x0d, 0x6d, 0x5b, 0x90, 0xa0, 0x8f, 0x70,
+	0x62, 0x1d, 0xea, 0x6a, 0x2b, 0x06, 0xeb, 0x04, 0xcc, 0x29, 0xd4, 0x19,
+	0xad, 0xb9, 0x12, 0xdc, 0x17, 0x5a, 0xb3, 0xbe, 0xdd, 0x84, 0x23, 0x37,
+	0x93, 0x55, 0x34, 0x20, 0x33, 0x41, 0x93, 0x6b, 0x95, 0x42, 0xb9, 0x6a,
+	0xd7, 0x70, 0x48, 0x66, 0xfb, 0xeb, 0x4b, 0x74, 0x4e, 0x8e, 0xd2, 0x28,
+	0xd1, 0x1c, 0x41, 0x56, 0x84, 0xe8, 0x61, 0x40, 0xda, 0xec, 0x43, 0xc8,
+	0x91, 0x9a, 0x56, 0xa8, 0xc6, 0x97, 0xe7, 0xf3, 0x6b, 0x8a, 0xe4, 0xe2,
+	0xc0, 0xa4, 0xd3, 0xfc, 0x04, 0x17, 0x07, 0xf2, 0xf9, 0xfb, 0xda, 0x06,
+	0x86, 0x00, 0x50, 0xf6, 0xa0, 0x5c, 0xce, 0xfe, 0x73, 0x0c, 0x1e, 0xf2,
+	0x89, 0x4c, 0xab, 0x56, 0x80, 0x9f, 0x35, 0x09, 0xfd, 0xfd, 0x62, 0x89,
+	0xfc, 0x14, 0x17, 0x9e, 0x01, 0x65, 0xb6, 0x03, 0x1b, 0x8a, 0xce, 0x60,
+	0x77, 0x04, 0xd0, 0x24, 0x65, 0xfb, 0xfe, 0x61, 0xc0, 0xfb, 0x9b, 0x7b,
+	0x95, 0x43, 0x6d, 0x43, 0x2d, 0x3f, 0x2f, 0xf0, 0xe3, 0xf4, 0x79, 0x83,
+	0x7d, 0x03, 0xe2, 0x9f, 0x1a, 0xe8, 0xcd, 0x28, 0x68, 0x9c, 0xa9, 0x82,
+	0xfa, 0xc1, 0xfc, 0x4a, 0x82, 0x3c, 0x11, 0xd4, 0x4a, 0xe4, 0xaa, 0x17,
+	0xfa, 0xa4, 0x5a, 0x37, 0x26, 0x84, 0xcd, 0x35, 0xf1, 0xd5, 0x13, 0x00,
+	0xe8, 0x98, 0x83, 0x36, 0x4b, 0xd3, 0x33, 0x0e, 0xbc, 0xc3, 0xd4, 0xb3,
+	0x75, 0xb7, 0xb8, 0xae, 0x0f, 0x84, 0x57, 0x36, 0x92, 0xc0, 0xf7, 0xf5,
+	0x1d, 0xe0, 0xc7, 0x93, 0xed, 0x91, 0x2c, 0xce, 0x51, 0x0f, 0x7f, 0x7f,
+	0x94, 0x4a, 0xfb, 0xf4, 0x38, 0x14, 0x17, 0x01, 0x19, 0x98, 0x47, 0xff,
+	0x01, 0xd0, 0x6b, 0x22, 0x9d, 0xe3, 0xdd, 0xdf, 0x36, 0xf4, 0x38, 0xa3,
+	0xd4, 0x47, 0x10, 0x17, 0xf9, 0x55, 0x87, 0x2d, 0x09, 0x74, 0xde, 0xa8,
+	0x40, 0x6e, 0x27, 0xa5, 0x57, 0x5b, 0xfd, 0xcd, 0x25, 0xa7, 0x43, 0x2a,
+	0x5f, 0xd7, 0x6f, 0xd2, 0xb2, 0x1f, 0xb4, 0x12, 0x3f, 0xc2, 0x18, 0xf2,
+	0x1a, 0x13, 0xd8, 0x26, 0x44, 0x7d, 0x32, 0xde, 0xa3, 0x3d, 0x35, 0xd5,
+	0x0a, 0xf2, 0xb2, 0xd3, 0x00, 0xe7, 0x46, 0x95, 0xe4, 0xa3, 0x65, 0x91,
+	0x91, 0x5f, 0x94, 0x5d, 0xfa, 0x5b, 0x6b, 0xa9, 0x47, 0xe9, 0xe3, 0x8a,
+	0xb9, 0x7c, 0x92, 0xe5, 0x7b, 0xb9, 0xb9, 0x0e, 0x22, 0x4b, 0x1a, 0x62,
+	0xdf, 0x97, 0x0a, 0xa8, 0xc9, 0x93, 0x3d, 0x47, 0xe1, 0xd5, 0x60, 0xc5,
+	0x24, 0x9e, 0xbf, 0x19, 0x8e, 0x07, 0x50, 0x57, 0xbc, 0x9a, 0x52, 0xd6,
+	0xc0, 0xc7, 0x93, 0xcd, 0x38, 0xd8, 0x66, 0x9f, 0xac, 0x9e, 0x6d, 0xe3,
+	0xb5, 0x06, 0xc8, 0x31, 0xad, 0x49, 0x25, 0xb0, 0x10, 0xce, 0x7e, 0x1c,
+	0x8d, 0x5c, 0xd0, 0x97, 0x18, 0x6a, 0x80, 0xee, 0x79, 0xd6, 0x4b, 0xef,
+	0xae, 0xdb, 0xfe, 0xc8, 0xa7, 0x8d, 0x13, 0x56, 0x44, 0xef, 0xb1, 0xd4,
+	0x8d, 0x26, 0x8e, 0x8b, 0xa0, 0x46, 0x0e, 0xba, 0x71, 0x15, 0x21, 0xa6,
+	0x11, 0x30, 0xfd, 0xd3, 0xbf, 0x66, 0x0f, 0x6b, 0x09, 0x50, 0xf2, 0x49,
+	0x26, 0xc5, 0x7f, 0x0a, 0x30, 0x6f, 0x4b, 0x23, 0xa9, 0xeb, 0xa7, 0xb6,
+	0x3c, 0x36, 0x18, 0x87, 0x20, 0xae, 0xd6, 0xba, 0xfe, 0x4a, 0x9b, 0x7a,
+	0xcc, 0x03, 0xe9, 0x98, 0x9e, 0x43, 0xeb, 0xcc, 0xbc, 0xa8, 0xf7, 0xd9,
+	0x87, 0x80, 0xd9, 0x5b, 0xf6, 0x43, 0xf6, 0x36, 0x57, 0x12, 0xbb, 0xd5,
+	0x49, 0x68, 0x60, 0xa6, 0x2f, 0xa0, 0x62, 0xad, 0xb8, 0xe1, 0x88, 0x7b,
+	0x12, 0x54, 0x50, 0xc4, 0x04, 0x17, 0xe4, 0x88, 0xff, 0xa2, 0x5d, 0xa3,
+	0x85, 0x65, 0xb5, 0x20, 0x59, 0xa3, 0x9d, 0x58, 0xf4, 0x5b, 0xce, 0xf5,
+	0x3e, 0x6c, 0xa4, 0x08, 0x70, 0xb1, 0x58, 0x7b, 0xd0, 0x9b, 0x08, 0xd2,
+	0x99, 0x62, 0x9d, 0x97, 0xa8, 0x76, 0xad, 0x8f, 0x2c, 0x96, 0x08, 0xe9,
+	0xad, 0x00, 0xe2, 0xa3, 0xc6, 0x28, 0x0a, 0x18, 0x2e, 0x45, 0xd7, 0x32,
+	0xff, 0xd2, 0xf3, 0x94, 0x33, 0x4f, 0x05, 0x0c, 0xcf, 0xc2, 0x7c, 0x92,
+	0x88, 0x75, 0xe2, 0x2a, 0x15, 0x14, 0xc4, 0x0d, 0x32, 0x6a, 0x7d, 0xf0,
+	0xb8, 0x05, 0x5c, 0x08, 0xab, 0x6d, 0x1b, 0xc9, 0x0c, 0x2f, 0xda, 0x79,
+	0x02, 0xd0, 0x0d, 0xce, 0x3e, 0xae, 0xc4, 0x53, 0xab, 0x4b, 0x69, 0xda,
+	0x1b, 0x78, 0xe9, 0xa0, 0x2d, 0xb7, 0x4a, 0x49, 0x30, 0xf7, 0x7a, 0x83,
+	0x16, 0x84, 0x24, 0x2b, 0x52, 0x18, 0x9b, 0x28, 0xe7, 0x51, 0xf2, 0x21,
+	0x97, 0xdd, 0x13, 0xb9, 0x8f, 0xe9, 0x8e, 0xb4, 0x4d, 0x5d, 0xa0, 0x05,
+	0x34, 0x89, 0x12, 0x09, 0x91, 0x2c, 0x04, 0x4c, 0xaa, 0x7b, 0x7a, 0xd5,
+	0x36, 0x22, 0x2e, 0x9e, 0xfa, 0x31, 0x54, 0xbd, 0x59, 0x48, 0x95, 0xd1,
+	0x02, 0x70, 0xc2, 0x78, 0x00, 0xd0, 0x69, 0x7b, 0xc6, 0x2b, 0xa6, 0xd8,
+	0x6d, 0x40, 0x0c, 0x88, 0x82, 0xb5, 0x72, 0x7a, 0xed, 0x85, 0x9e, 0x99,
+	0x70, 0x5e, 0x7c, 0x27, 0xbc, 0xa8, 0xe3, 0xae, 0xfd, 0x12, 0x00,
+};
+
+#endif /* TESTS_BENCH_COMPRESSION_DATA_H */
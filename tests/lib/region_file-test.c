@@ -290,6 +290,103 @@ static void test_region_file_update_data_arr(void **state)
 	assert_memory_equal(&dummy_data[data3_offset], &output_buffer[data2_size], data3_size);
 }
 
+static size_t erase_calls;
+static size_t write_calls;
+static uint8_t *flash_buffer;
+
+static ssize_t counting_writeat(const struct region_device *rd, const void *b,
+				size_t offset, size_t size)
+{
+	write_calls++;
+	return mem_rdev_rw_ops.writeat(rd, b, offset, size);
+}
+
+/* Unlike mem_rdev_rw_ops, erase to 0xff like flash does. */
+static ssize_t counting_eraseat(const struct region_device *rd, size_t offset, size_t size)
+{
+	erase_calls++;
+	memset(flash_buffer + offset, 0xff, size);
+	return size;
+}
+
+static void test_region_file_update_data_rewrite(void **state)
+{
+	/* Two erase blocks and an update too large to have two of them in the region. */
+	const size_t region_size = 2 * REGF_ERASE_BLOCK_SIZE;
+	const size_t data_size = 5000;
+	struct region_device_ops counting_ops = mem_rdev_rw_ops;
+	struct mem_region_device mdev;
+	struct region_device read_rdev;
+	struct region_file regf;
+	uint8_t *buffer = malloc(region_size);
+	uint8_t *data = malloc(data_size);
+	uint8_t *output = malloc(data_size);
+
+	assert_non_null(buffer);
+	assert_non_null(data);
+	assert_non_null(output);
+
+	counting_ops.writeat = counting_writeat;
+	counting_ops.eraseat = counting_eraseat;
+	mdev = (struct mem_region_device)MEM_REGION_DEV_INIT(buffer, region_size,
+							    &counting_ops);
+	flash_buffer = buffer;
+	memset(buffer, 0xff, region_size);
+	for (int i = 0; i < data_size; ++i)
+		data[i] = 'A' + i % ('Z' - 'A');
+
+	assert_int_equal(0, region_file_init(&regf, &mdev.rdev));
+	assert_int_equal(0, region_file_update_data(&regf, data, data_size));
+
+	/* Change data only in the second erase block. The first one must stay untouched. */
+	data[data_size - 1] ^= 0xff;
+	erase_calls = 0;
+	write_calls = 0;
+	assert_int_equal(0, region_file_init(&regf, &mdev.rdev));
+	assert_int_equal(0, region_file_update_data(&regf, data, data_size));
+	assert_int_equal(1, erase_calls);
+	assert_int_equal(DIV_ROUND_UP(data_size + REGF_METADATA_BLOCK_SIZE
+				      - REGF_ERASE_BLOCK_SIZE, REGF_REWRITE_CHUNK_SIZE),
+			 write_calls);
+	assert_int_equal(0, region_file_data(&regf, &read_rdev));
+	assert_int_equal(ALIGN_UP(data_size, 16), region_device_sz(&read_rdev));
+	rdev_readat(&read_rdev, output, 0, data_size);
+	assert_memory_equal(data, output, data_size);
+
+	/* Unchanged data is neither erased nor programmed again. */
+	erase_calls = 0;
+	write_calls = 0;
+	assert_int_equal(0, region_file_init(&regf, &mdev.rdev));
+	assert_int_equal(0, region_file_update_data(&regf, data, data_size));
+	assert_int_equal(0, erase_calls);
+	assert_int_equal(0, write_calls);
+
+	/* Data which only clears bits is programmed without erasing. */
+	data[0] = 0;
+	erase_calls = 0;
+	write_calls = 0;
+	assert_int_equal(0, region_file_init(&regf, &mdev.rdev));
+	assert_int_equal(0, region_file_update_data(&regf, data, data_size));
+	assert_int_equal(0, erase_calls);
+	assert_int_equal(1, write_calls);
+
+	/* A smaller update, still too large to be appended, leaves the region as if it
+	   was emptied first. */
+	assert_int_equal(0, region_file_init(&regf, &mdev.rdev));
+	assert_int_equal(0, region_file_update_data(&regf, data, data_size * 2 / 3));
+	assert_int_equal(0, region_file_init(&regf, &mdev.rdev));
+	assert_int_equal(1, regf.slot);
+	for (size_t i = REGF_METADATA_BLOCK_SIZE + data_size * 2 / 3; i < region_size; ++i)
+		assert_int_equal(0xff, buffer[i]);
+	assert_int_equal(0, region_file_data(&regf, &read_rdev));
+	rdev_readat(&read_rdev, output, 0, data_size * 2 / 3);
+	assert_memory_equal(data, output, data_size * 2 / 3);
+
+	free(buffer);
+	free(data);
+	free(output);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
@@ -323,6 +420,7 @@ int main(void)
 		cmocka_unit_test_setup_teardown(test_region_file_update_data_arr,
 				setup_teardown_region_file_test,
 				setup_teardown_region_file_test),
+		cmocka_unit_test(test_region_file_update_data_rewrite),
 	};
 
 	return cmocka_run_group_tests(tests,
@@ -58,8 +58,11 @@
 #include <getopt.h>
 #include <libgen.h>
 #include <stdint.h>
+#include <inttypes.h>
+#include <time.h>
 
 #include "amdfwtool.h"
+#include "lz4/lib/xxhash.h"
 
 #define AMD_ROMSIG_OFFSET	0x20000
 #define MIN_ROM_KB		256
@@ -110,37 +113,55 @@
  *    stdout:   Copied from the input file with the Fletcher's Checksum
  *              inserted 8 bytes after the beginning of the file.
  *    stderr:   Used to print out error messages.
+ *
+ * The words are summed a block at a time. Over a block of n words, c0 grows
+ * by their sum and c1 by n * c0 plus their sum weighted by n - i, so neither
+ * sum depends on the previous iteration and the compiler can vectorize the
+ * loop. Both sums are reduced modulo 65535 after each block, with 0 kept as
+ * 0xFFFF, which gives the same result as summing word by word.
  */
+#define FLETCHER32_BLOCK 256
+
 static uint32_t fletcher32(const void *data, int length)
 {
-	uint32_t c0;
-	uint32_t c1;
-	uint32_t checksum;
-	int index;
+	uint16_t tail[FLETCHER32_BLOCK];
 	const uint16_t *pptr = data;
+	uint64_t c0 = 0xFFFF;
+	uint64_t c1 = 0xFFFF;
+	uint32_t words = length / 2;
+
+	while (words) {
+		const uint16_t *block = pptr;
+		uint32_t n = FLETCHER32_BLOCK;
+		uint32_t s0 = 0, s1 = 0;
+		unsigned int i;
+
+		if (words < FLETCHER32_BLOCK) {
+			/* Leading zeros don't change either sum of the block */
+			n = words;
+			memset(tail, 0, (FLETCHER32_BLOCK - n) * sizeof(*tail));
+			memcpy(tail + FLETCHER32_BLOCK - n, pptr, n * sizeof(*tail));
+			block = tail;
+		}
 
-	length /= 2;
-
-	c0 = 0xFFFF;
-	c1 = 0xFFFF;
+		/* At most 65535 * 256 * 257 / 2 for s1, so neither overflows */
+		for (i = 0; i < FLETCHER32_BLOCK; i++) {
+			s0 += block[i];
+			s1 += (FLETCHER32_BLOCK - i) * block[i];
+		}
 
-	while (length) {
-		index = length >= 359 ? 359 : length;
-		length -= index;
-	do {
-		c0 += *(pptr++);
-		c1 += c0;
-	} while (--index);
-		c0 = (c0 & 0xFFFF) + (c0 >> 16);
-		c1 = (c1 & 0xFFFF) + (c1 >> 16);
+		c1 = (c1 + n * c0 + s1) % 0xFFFF;
+		c0 = (c0 + s0) % 0xFFFF;
+		pptr += n;
+		words -= n;
 	}
 
-	/* Sums[0,1] mod 64K + overflow */
-	c0 = (c0 & 0xFFFF) + (c0 >> 16);
-	c1 = (c1 & 0xFFFF) + (c1 >> 16);
-	checksum = (c1 << 16) | c0;
+	if (!c0)
+		c0 = 0xFFFF;
+	if (!c1)
+		c1 = 0xFFFF;
 
-	return checksum;
+	return (uint32_t)(c1 << 16) | (uint32_t)c0;
 }
 
 static void usage(void)
@@ -190,6 +211,9 @@ static void usage(void)
 	printf("--soc-name <socname>           Specify SOC name. Supported names are\n");
 	printf("                               Stoneyridge, Raven, Picasso, Renoir, Cezanne\n");
 	printf("                               or Lucienne\n");
+	printf("--cache <FILE>                 Keep the hashes of the integrated blobs in FILE\n");
+	printf("                               and only rebuild the directories whose\n");
+	printf("                               inputs changed since the last run\n");
 	printf("\nEmbedded Firmware Structure options used by the PSP:\n");
 	printf("--spi-speed <HEX_VAL>          SPI fast speed to place in EFS Table\n");
 	printf("                               0x0 66.66Mhz\n");
@@ -490,6 +514,410 @@ static ssize_t copy_blob(void *dest, const char *src_file, size_t room)
 	return bytes;
 }
 
+/*
+ * Directory cache, enabled with --cache: records the content hash of every
+ * blob integrated into the PSP and BIOS directories and where each directory
+ * was placed. The next run takes a directory from the previous output when it
+ * is built at the same place from the same inputs, instead of copying its
+ * blobs and computing its checksum again.
+ */
+#define CACHE_MAGIC "amdfwtool-cache 1"
+#define MAX_CACHED_DIRS 8
+
+typedef struct _cached_blob {
+	char *path;
+	uint64_t hash;
+	/* Identity of the file the hash was computed from */
+	uint64_t size;
+	uint64_t dev;
+	uint64_t ino;
+	int64_t mtime;
+} cached_blob;
+
+typedef struct _cached_dir {
+	uint64_t key;		/* hash of all inputs of the directory */
+	uint32_t start;		/* offset of the directory table */
+	uint32_t end;		/* offset past its last blob */
+} cached_dir;
+
+typedef struct _cached_run {
+	cached_blob *blobs;
+	unsigned int num_blobs;
+	cached_dir dirs[MAX_CACHED_DIRS];
+	unsigned int num_dirs;
+} cached_run;
+
+static struct {
+	const char *path;	/* NULL if the cache is not used */
+	int64_t started;	/* start of this run */
+	int64_t saved;		/* start of the run that saved the cache */
+	uint32_t base;		/* offset of the output within the ROM */
+	char *output;		/* previous output, NULL if it can't be used */
+	size_t output_size;
+	cached_run prev;
+	cached_run cur;
+	unsigned int reused;
+} cache;
+
+static cached_blob *find_cached_blob(cached_run *run, const char *path)
+{
+	unsigned int i;
+
+	for (i = 0; i < run->num_blobs; i++) {
+		if (!strcmp(run->blobs[i].path, path))
+			return &run->blobs[i];
+	}
+	return NULL;
+}
+
+static cached_dir *find_cached_dir(cached_run *run, uint32_t start)
+{
+	unsigned int i;
+
+	for (i = 0; i < run->num_dirs; i++) {
+		if (run->dirs[i].start == start)
+			return &run->dirs[i];
+	}
+	return NULL;
+}
+
+static int add_cached_blob(cached_run *run, const cached_blob *blob)
+{
+	cached_blob *blobs;
+
+	blobs = realloc(run->blobs, (run->num_blobs + 1) * sizeof(*blobs));
+	if (!blobs)
+		return -1;
+	run->blobs = blobs;
+	blobs[run->num_blobs] = *blob;
+	blobs[run->num_blobs].path = strdup(blob->path);
+	if (!blobs[run->num_blobs].path)
+		return -1;
+	run->num_blobs++;
+	return 0;
+}
+
+static void free_cached_run(cached_run *run)
+{
+	unsigned int i;
+
+	for (i = 0; i < run->num_blobs; i++)
+		free(run->blobs[i].path);
+	free(run->blobs);
+	run->blobs = NULL;
+	run->num_blobs = 0;
+	run->num_dirs = 0;
+}
+
+/*
+ * Returns the content hash of a blob. The file is only read again if it
+ * changed since the previous run hashed it. A file modified in the second
+ * that run started can't be told apart from its earlier version by its
+ * identity, so it's always read again.
+ */
+static int hash_blob(const char *path, uint64_t *hash)
+{
+	cached_blob blob, *prev;
+	struct stat st;
+	char *data;
+
+	prev = find_cached_blob(&cache.cur, path);
+	if (prev) {
+		*hash = prev->hash;
+		return 0;
+	}
+
+	if (stat(path, &st))
+		return -1;
+
+	blob.path = (char *)path;
+	blob.size = st.st_size;
+	blob.dev = st.st_dev;
+	blob.ino = st.st_ino;
+	blob.mtime = st.st_mtime;
+
+	prev = find_cached_blob(&cache.prev, path);
+	if (prev && prev->size == blob.size && prev->dev == blob.dev &&
+			prev->ino == blob.ino && prev->mtime == blob.mtime &&
+			blob.mtime < cache.saved) {
+		blob.hash = prev->hash;
+	} else {
+		data = malloc(blob.size ? blob.size : 1);
+		if (!data)
+			return -1;
+		if (copy_blob(data, path, blob.size) != (ssize_t)blob.size) {
+			free(data);
+			return -1;
+		}
+		blob.hash = XXH64(data, blob.size, 0);
+		free(data);
+	}
+
+	if (add_cached_blob(&cache.cur, &blob))
+		return -1;
+	*hash = blob.hash;
+	return 0;
+}
+
+static void hash_value(XXH64_state_t *state, uint64_t value)
+{
+	XXH64_update(state, &value, sizeof(value));
+}
+
+static int hash_file(XXH64_state_t *state, const char *path)
+{
+	uint64_t hash = 0;
+
+	if (path && hash_blob(path, &hash))
+		return -1;
+	hash_value(state, hash);
+	return 0;
+}
+
+/* Starts the key of a directory with where it is placed and what it points to. */
+static int hash_dir_placement(XXH64_state_t *state, context *ctx, void *dir,
+				void *dir2, int level, uint32_t cookie)
+{
+	cached_dir *level2;
+
+	XXH64_reset(state, cookie);
+	hash_value(state, ctx->rom_size);
+	hash_value(state, cache.base);
+	hash_value(state, (char *)dir - ctx->rom);
+	hash_value(state, level);
+
+	/* A first level directory depends on the entries of the second level */
+	if (dir2) {
+		level2 = find_cached_dir(&cache.cur, (char *)dir2 - ctx->rom);
+		if (!level2)
+			return -1;
+		hash_value(state, level2->start);
+		hash_value(state, level2->key);
+	}
+	return 0;
+}
+
+static int psp_dir_key(context *ctx, void *dir, void *dir2,
+			amd_fw_entry *fw_table, int level, uint32_t cookie,
+			uint64_t *key)
+{
+	XXH64_state_t state;
+	unsigned int i;
+
+	if (hash_dir_placement(&state, ctx, dir, dir2, level, cookie))
+		return -1;
+
+	for (i = 0; fw_table[i].type != AMD_FW_INVALID; i++) {
+		if (!(fw_table[i].level & level))
+			continue;
+		hash_value(&state, fw_table[i].type);
+		hash_value(&state, fw_table[i].subprog);
+		hash_value(&state, fw_table[i].level);
+		hash_value(&state, fw_table[i].other);
+		if (hash_file(&state, fw_table[i].filename))
+			return -1;
+	}
+
+	*key = XXH64_digest(&state);
+	return 0;
+}
+
+static int bios_dir_key(context *ctx, void *dir, void *dir2,
+			amd_bios_entry *fw_table, int level, uint32_t cookie,
+			uint64_t *key)
+{
+	XXH64_state_t state;
+	unsigned int i;
+
+	if (hash_dir_placement(&state, ctx, dir, dir2, level, cookie))
+		return -1;
+
+	for (i = 0; fw_table[i].type != AMD_BIOS_INVALID; i++) {
+		if (!(fw_table[i].level & level))
+			continue;
+		hash_value(&state, fw_table[i].type);
+		hash_value(&state, fw_table[i].subpr);
+		hash_value(&state, fw_table[i].region_type);
+		hash_value(&state, fw_table[i].reset);
+		hash_value(&state, fw_table[i].copy);
+		hash_value(&state, fw_table[i].ro);
+		hash_value(&state, fw_table[i].zlib);
+		hash_value(&state, fw_table[i].inst);
+		hash_value(&state, fw_table[i].src);
+		hash_value(&state, fw_table[i].dest);
+		hash_value(&state, fw_table[i].size);
+		hash_value(&state, fw_table[i].level);
+		if (hash_file(&state, fw_table[i].filename))
+			return -1;
+	}
+
+	*key = XXH64_digest(&state);
+	return 0;
+}
+
+static void record_dir(context *ctx, void *dir, uint64_t key)
+{
+	cached_dir *entry;
+
+	if (cache.cur.num_dirs == MAX_CACHED_DIRS)
+		return;
+	entry = &cache.cur.dirs[cache.cur.num_dirs++];
+	entry->key = key;
+	entry->start = (char *)dir - ctx->rom;
+	entry->end = ctx->current;
+}
+
+/*
+ * Copies the directory at dir and its blobs from the previous output if they
+ * were built there from the same inputs. Returns 1 if they were, with
+ * ctx->current past them.
+ */
+static int reuse_dir(context *ctx, void *dir, uint64_t key)
+{
+	cached_dir *prev;
+
+	if (!cache.output)
+		return 0;
+
+	prev = find_cached_dir(&cache.prev, (char *)dir - ctx->rom);
+	if (!prev || prev->key != key || prev->start < cache.base ||
+			prev->end < prev->start || prev->end > ctx->rom_size ||
+			prev->end - cache.base > cache.output_size)
+		return 0;
+
+	memcpy(BUFF_OFFSET(*ctx, prev->start),
+		cache.output + prev->start - cache.base,
+		prev->end - prev->start);
+	ctx->current = prev->end;
+	record_dir(ctx, dir, key);
+	cache.reused++;
+	return 1;
+}
+
+/*
+ * Reads the cache and the output it was saved with. A missing or stale cache
+ * is not an error, every directory is built then.
+ */
+static void load_cache(const char *path, const char *output, uint32_t base)
+{
+	uint64_t output_hash = 0, output_size = 0;
+	char *line = NULL;
+	size_t len = 0;
+	FILE *f;
+	int fd;
+
+	cache.path = path;
+	cache.base = base;
+	cache.started = time(NULL);
+
+	f = fopen(path, "r");
+	if (!f)
+		return;
+
+	if (getline(&line, &len, f) < 0 || strcmp(line, CACHE_MAGIC "\n")) {
+		fprintf(stderr, "Warning: Ignoring cache %s\n", path);
+		goto out;
+	}
+
+	while (getline(&line, &len, f) > 0) {
+		cached_blob blob;
+		cached_dir *dir;
+		long long saved;
+		int pos = 0;
+
+		line[strcspn(line, "\n")] = '\0';
+		if (sscanf(line, "saved %lld", &saved) == 1) {
+			cache.saved = saved;
+		} else if (!strncmp(line, "output ", 7)) {
+			sscanf(line, "output %" SCNx64 " %" SCNu64, &output_hash,
+				&output_size);
+		} else if (!strncmp(line, "dir ", 4) &&
+				cache.prev.num_dirs < MAX_CACHED_DIRS) {
+			dir = &cache.prev.dirs[cache.prev.num_dirs];
+			if (sscanf(line, "dir %" SCNx64 " %" SCNx32 " %" SCNx32,
+					&dir->key, &dir->start, &dir->end) == 3)
+				cache.prev.num_dirs++;
+		} else if (sscanf(line, "blob %" SCNx64 " %" SCNu64 " %" SCNu64
+				" %" SCNu64 " %" SCNd64 " %n", &blob.hash,
+				&blob.size, &blob.dev, &blob.ino, &blob.mtime,
+				&pos) == 5 && pos) {
+			blob.path = line + pos;
+			if (add_cached_blob(&cache.prev, &blob))
+				goto out;
+		}
+	}
+
+	/* Only take directories from the output the cache was saved with */
+	if (!output_size)
+		goto out;
+	fd = open(output, O_RDONLY);
+	if (fd < 0)
+		goto out;
+	cache.output = malloc(output_size);
+	if (!cache.output || read(fd, cache.output, output_size) !=
+			(ssize_t)output_size || read(fd, line, 1) != 0 ||
+			XXH64(cache.output, output_size, 0) != output_hash) {
+		free(cache.output);
+		cache.output = NULL;
+	} else {
+		cache.output_size = output_size;
+	}
+	close(fd);
+
+out:
+	free(line);
+	fclose(f);
+}
+
+/* Saves the cache for the output just written. */
+static void save_cache(const void *output, size_t output_size)
+{
+	char *tmp;
+	unsigned int i;
+	FILE *f;
+	int err;
+
+	tmp = malloc(strlen(cache.path) + sizeof(".tmp"));
+	if (!tmp) {
+		fprintf(stderr, "Error: Failed to allocate memory\n");
+		return;
+	}
+	sprintf(tmp, "%s.tmp", cache.path);
+
+	f = fopen(tmp, "w");
+	if (!f) {
+		fprintf(stderr, "Warning: Could not write cache %s: %s\n",
+			tmp, strerror(errno));
+		free(tmp);
+		return;
+	}
+
+	fprintf(f, CACHE_MAGIC "\n");
+	fprintf(f, "saved %lld\n", (long long)cache.started);
+	fprintf(f, "output %" PRIx64 " %zu\n",
+		(uint64_t)XXH64(output, output_size, 0), output_size);
+	for (i = 0; i < cache.cur.num_dirs; i++) {
+		fprintf(f, "dir %" PRIx64 " %" PRIx32 " %" PRIx32 "\n",
+			cache.cur.dirs[i].key, cache.cur.dirs[i].start,
+			cache.cur.dirs[i].end);
+	}
+	for (i = 0; i < cache.cur.num_blobs; i++) {
+		cached_blob *blob = &cache.cur.blobs[i];
+
+		fprintf(f, "blob %" PRIx64 " %" PRIu64 " %" PRIu64 " %" PRIu64
+			" %" PRId64 " %s\n", blob->hash, blob->size, blob->dev,
+			blob->ino, blob->mtime, blob->path);
+	}
+
+	err = ferror(f);
+	if (fclose(f) || err || rename(tmp, cache.path)) {
+		fprintf(stderr, "Warning: Could not write cache %s\n",
+			cache.path);
+		unlink(tmp);
+	}
+	free(tmp);
+}
+
 static void integrate_firmwares(context *ctx,
 				embedded_firmware *romsig,
 				amd_fw_entry *fw_table)
@@ -590,6 +1018,8 @@ static void integrate_psp_firmwares(context *ctx,
 	ssize_t bytes;
 	unsigned int i, count;
 	int level;
+	int cached;
+	uint64_t key;
 
 	/* This function can create a primary table, a secondary table, or a
 	 * flattened table which contains all applicable types.  These if-else
@@ -605,6 +1035,11 @@ static void integrate_psp_firmwares(context *ctx,
 	else
 		level = PSP_BOTH;
 
+	cached = cache.path && !psp_dir_key(ctx, pspdir, pspdir2, fw_table,
+						level, cookie, &key);
+	if (cached && reuse_dir(ctx, pspdir, key))
+		return;
+
 	ctx->current = ALIGN(ctx->current, TABLE_ALIGNMENT);
 
 	for (i = 0, count = 0; fw_table[i].type != AMD_FW_INVALID; i++) {
@@ -695,6 +1130,8 @@ static void integrate_psp_firmwares(context *ctx,
 	}
 
 	fill_dir_header(pspdir, count, cookie, ctx);
+	if (cached)
+		record_dir(ctx, pspdir, key);
 }
 
 static void *new_bios_dir(context *ctx, int multi)
@@ -771,6 +1208,8 @@ static void integrate_bios_firmwares(context *ctx,
 	int apob_idx;
 	uint32_t size;
 	uint64_t source;
+	int cached;
+	uint64_t key;
 
 	/* This function can create a primary table, a secondary table, or a
 	 * flattened table which contains all applicable types.  These if-else
@@ -786,6 +1225,11 @@ static void integrate_bios_firmwares(context *ctx,
 	else
 		level = BDT_BOTH;
 
+	cached = cache.path && !bios_dir_key(ctx, biosdir, biosdir2, fw_table,
+						level, cookie, &key);
+	if (cached && reuse_dir(ctx, biosdir, key))
+		return;
+
 	ctx->current = ALIGN(ctx->current, TABLE_ALIGNMENT);
 
 	for (i = 0, count = 0; fw_table[i].type != AMD_BIOS_INVALID; i++) {
@@ -957,6 +1401,8 @@ static void integrate_bios_firmwares(context *ctx,
 	}
 
 	fill_dir_header(biosdir, count, cookie, ctx);
+	if (cached)
+		record_dir(ctx, biosdir, key);
 }
 
 enum {
@@ -999,6 +1445,7 @@ enum {
 	AMDFW_OPT_SHAREDMEM,
 	AMDFW_OPT_SHAREDMEM_SIZE,
 	AMDFW_OPT_SOC_NAME,
+	AMDFW_OPT_CACHE,
 	/* begin after ASCII characters */
 	LONGOPT_SPI_READ_MODE	= 256,
 	LONGOPT_SPI_SPEED	= 257,
@@ -1048,6 +1495,7 @@ static struct option long_options[] = {
 	{"sharedmem",        required_argument, 0, AMDFW_OPT_SHAREDMEM },
 	{"sharedmem-size",   required_argument, 0, AMDFW_OPT_SHAREDMEM_SIZE },
 	{"soc-name",         required_argument, 0, AMDFW_OPT_SOC_NAME },
+	{"cache",            required_argument, 0, AMDFW_OPT_CACHE },
 
 	{"config",           required_argument, 0, AMDFW_OPT_CONFIG },
 	{"debug",            no_argument,       0, AMDFW_OPT_DEBUG },
@@ -1237,7 +1685,7 @@ int main(int argc, char **argv)
 	int comboable = 0;
 	int fuse_defined = 0;
 	int targetfd;
-	char *output = NULL, *config = NULL;
+	char *output = NULL, *config = NULL, *cache_file = NULL;
 	FILE *config_handle;
 	context ctx = { 0 };
 	/* Values cleared after each firmware or parameter, regardless if N/A */
@@ -1398,6 +1846,9 @@ int main(int argc, char **argv)
 		case AMDFW_OPT_OUTPUT:
 			output = optarg;
 			break;
+		case AMDFW_OPT_CACHE:
+			cache_file = optarg;
+			break;
 		case AMDFW_OPT_FLASHSIZE:
 			ctx.rom_size = (uint32_t)strtoul(optarg, &tmp, 16);
 			if (*tmp != '\0') {
@@ -1539,6 +1990,9 @@ int main(int argc, char **argv)
 	printf("    AMDFWTOOL  Using firmware directory location of 0x%08x\n",
 			RUN_CURRENT(ctx));
 
+	if (cache_file)
+		load_cache(cache_file, output, romsig_offset);
+
 	amd_romsig = BUFF_OFFSET(ctx, romsig_offset);
 	amd_romsig->signature = EMBEDDED_FW_SIGNATURE;
 	amd_romsig->imc_entry = 0;
@@ -1640,11 +2094,19 @@ int main(int argc, char **argv)
 			retval = 1;
 		}
 		close(targetfd);
+		if (!retval && cache.path) {
+			printf("    AMDFWTOOL  Reused %u of %u directories\n",
+				cache.reused, cache.cur.num_dirs);
+			save_cache(amd_romsig, ctx.current - romsig_offset);
+		}
 	} else {
 		fprintf(stderr, "Error: could not open file: %s\n", output);
 		retval = 1;
 	}
 
+	free_cached_run(&cache.prev);
+	free_cached_run(&cache.cur);
+	free(cache.output);
 	free(rom);
 	return retval;
 }
@@ -0,0 +1,213 @@
+/* build many variants of an image from a manifest */
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "batch.h"
+
+struct job {
+	pid_t pid;
+	unsigned int line;
+};
+
+static char *read_manifest(const char *manifest)
+{
+	FILE *f = fopen(manifest, "r");
+	char *data = NULL;
+	size_t size = 0, len = 0;
+
+	if (!f) {
+		fprintf(stderr, "Could not open %s: %s\n", manifest,
+			strerror(errno));
+		return NULL;
+	}
+
+	do {
+		if (len + 1 >= size) {
+			char *grown;
+
+			size = size ? size * 2 : 4096;
+			grown = realloc(data, size);
+			if (!grown) {
+				fprintf(stderr, "Out of memory.\n");
+				free(data);
+				fclose(f);
+				return NULL;
+			}
+			data = grown;
+		}
+		len += fread(data + len, 1, size - len - 1, f);
+	} while (!feof(f) && !ferror(f));
+
+	if (ferror(f)) {
+		fprintf(stderr, "Could not read %s\n", manifest);
+		free(data);
+		data = NULL;
+	} else {
+		data[len] = '\0';
+	}
+
+	fclose(f);
+	return data;
+}
+
+/* Splits line into words in place. Returns the number of words, -1 on error. */
+static int split_words(char *line, char ***words, size_t *capacity)
+{
+	int count = 1;
+
+	while (*line) {
+		if (isspace((unsigned char)*line)) {
+			*line++ = '\0';
+			continue;
+		}
+
+		if ((size_t)count + 2 > *capacity) {
+			char **grown;
+
+			*capacity = *capacity ? *capacity * 2 : 16;
+			grown = realloc(*words, *capacity * sizeof(**words));
+			if (!grown)
+				return -1;
+			*words = grown;
+		}
+		(*words)[count++] = line;
+
+		while (*line && !isspace((unsigned char)*line))
+			line++;
+	}
+
+	if (*words)
+		(*words)[count] = NULL;
+	return count;
+}
+
+/* Waits for one of the running jobs. Returns 0 if it succeeded. */
+static int wait_job(struct job *jobs, unsigned int *running,
+		    const char *manifest)
+{
+	unsigned int i, line;
+	int status;
+	pid_t pid;
+
+	do {
+		pid = wait(&status);
+	} while (pid < 0 && errno == EINTR);
+
+	if (pid < 0) {
+		perror("wait");
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < *running; i++)
+		if (jobs[i].pid == pid)
+			break;
+	if (i == *running)
+		return 0;
+
+	line = jobs[i].line;
+	jobs[i] = jobs[--*running];
+
+	if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+		return 0;
+
+	fprintf(stderr, "%s:%u: variant failed\n", manifest, line);
+	return -1;
+}
+
+int batch_run(const char *manifest, char *argv0, unsigned int jobs,
+	      batch_fn fn, void *arg)
+{
+	unsigned int running = 0, line_num = 0, variants = 0;
+	char *data, *line, *next;
+	char **words = NULL;
+	size_t capacity = 0;
+	struct job *job;
+	int failed = 0;
+
+	if (!jobs) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		jobs = cpus > 0 ? cpus : 1;
+	}
+
+	/* Read everything up front, children must not share a stdio stream with us. */
+	data = read_manifest(manifest);
+	if (!data)
+		return -1;
+
+	job = calloc(jobs, sizeof(*job));
+	if (!job) {
+		fprintf(stderr, "Out of memory.\n");
+		free(data);
+		return -1;
+	}
+
+	for (line = data; line; line = next) {
+		int argc;
+		pid_t pid;
+
+		line_num++;
+		next = strchr(line, '\n');
+		if (next)
+			*next++ = '\0';
+
+		while (isspace((unsigned char)*line))
+			line++;
+		if (*line == '#')
+			continue;
+
+		argc = split_words(line, &words, &capacity);
+		if (argc < 0) {
+			fprintf(stderr, "Out of memory.\n");
+			variants++;
+			failed++;
+			break;
+		}
+		if (argc < 2)
+			continue;
+		words[0] = argv0;
+
+		while (running >= jobs)
+			failed += !!wait_job(job, &running, manifest);
+
+		/* Don't let the children print our buffered output again. */
+		fflush(stdout);
+		fflush(stderr);
+
+		pid = fork();
+		if (pid < 0) {
+			perror("fork");
+			variants++;
+			failed++;
+			break;
+		}
+
+		if (pid == 0) {
+			optind = 1;
+			exit(fn(argc, words, arg));
+		}
+
+		job[running].pid = pid;
+		job[running].line = line_num;
+		running++;
+		variants++;
+	}
+
+	while (running)
+		failed += !!wait_job(job, &running, manifest);
+
+	printf("Built %u of %u variants from %s\n", variants - failed, variants,
+	       manifest);
+
+	free(words);
+	free(job);
+	free(data);
+	return failed;
+}
@@ -0,0 +1,34 @@
+/* build many variants of an image from a manifest */
+/* SPDX-License-Identifier: GPL-2.0-only */
+
+#ifndef BATCH_H_
+#define BATCH_H_
+
+/*
+ * Runs for each variant in the child process, with argv[0] being the argv0
+ * passed to batch_run(), argv[1] the output and the remaining words of the
+ * manifest line following. Returns the exit status of the child.
+ */
+typedef int (*batch_fn)(int argc, char *argv[], void *arg);
+
+/**
+ * Build the variants listed in a manifest, one per line as
+ * "<output> [arguments...]". Words are separated by whitespace, empty lines and
+ * lines starting with '#' are ignored.
+ *
+ * Every variant is built in a child process forked from the caller, so it
+ * starts from whatever the caller has loaded and parsed already. The image
+ * buffers are shared copy-on-write: a variant only copies the pages it changes.
+ *
+ * @param manifest Path of the manifest
+ * @param argv0    argv[0] passed to fn
+ * @param jobs     Maximum number of variants built at once, 0 for one per CPU
+ * @param fn       Builds a single variant
+ * @param arg      Passed to fn
+ * @return         Number of variants that failed, -1 if the manifest couldn't
+ *                 be read
+ */
+int batch_run(const char *manifest, char *argv0, unsigned int jobs,
+	      batch_fn fn, void *arg);
+
+#endif
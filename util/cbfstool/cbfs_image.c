@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include <sys/types.h>
 #include <commonlib/endian.h>
 #include <vb2_sha.h>
 
@@ -34,6 +35,218 @@
  * removing said guarantees.
  */
 
+/*
+ * Index of the empty entries of the image last used for placing files, so that
+ * cbfs_add_entry() and cbfs_locate_entry() don't need to walk (and merge) the
+ * whole entry chain for every file. Extents are sorted by address and each one
+ * covers an empty entry up to the next entry, i.e. [addr, end) is the space
+ * that used to be tested as [addr, addr_next) in the walks. A max-tree over the
+ * extent sizes finds the first extent that can hold a file in O(log n).
+ *
+ * The index is tied to the image buffer it was built from and is dropped by
+ * every function that rearranges entries other than cbfs_add_entry(), which
+ * updates it in place. An extent is also checked against the entry chain
+ * before it's used, and the index is rebuilt if it doesn't match anymore.
+ */
+struct cbfs_free_extent {
+	uint32_t addr;
+	uint32_t end;
+};
+
+static struct {
+	const char *data;
+	size_t size;
+	struct cbfs_free_extent *extents;
+	size_t count;
+	size_t capacity;
+	/* Max-tree over the extent sizes, leaves start at index 'leaves'. */
+	uint32_t *max_len;
+	size_t leaves;
+} free_index;
+
+static void free_index_invalidate(void)
+{
+	free_index.data = NULL;
+	free_index.size = 0;
+	free_index.count = 0;
+}
+
+static bool free_index_reserve(size_t count)
+{
+	if (count <= free_index.capacity)
+		return true;
+
+	size_t capacity = MAX(count, free_index.capacity * 2);
+	struct cbfs_free_extent *extents = realloc(free_index.extents,
+					capacity * sizeof(*extents));
+	if (!extents) {
+		ERROR("Out of memory for CBFS free space index\n");
+		return false;
+	}
+	free_index.extents = extents;
+	free_index.capacity = capacity;
+	return true;
+}
+
+static bool free_index_add(uint32_t addr, uint32_t end)
+{
+	if (!free_index_reserve(MAX(free_index.count + 1, 64)))
+		return false;
+	free_index.extents[free_index.count].addr = addr;
+	free_index.extents[free_index.count].end = end;
+	free_index.count++;
+	return true;
+}
+
+static bool free_index_update_tree(void)
+{
+	size_t leaves = 1;
+
+	while (leaves < free_index.count)
+		leaves *= 2;
+	if (leaves != free_index.leaves) {
+		uint32_t *max_len = realloc(free_index.max_len,
+					    2 * leaves * sizeof(*max_len));
+		if (!max_len) {
+			ERROR("Out of memory for CBFS free space index\n");
+			return false;
+		}
+		free_index.max_len = max_len;
+		free_index.leaves = leaves;
+	}
+
+	for (size_t i = 0; i < leaves; i++) {
+		free_index.max_len[leaves + i] = 0;
+		if (i < free_index.count)
+			free_index.max_len[leaves + i] =
+				free_index.extents[i].end -
+				free_index.extents[i].addr;
+	}
+	for (size_t i = leaves - 1; i > 0; i--)
+		free_index.max_len[i] = MAX(free_index.max_len[2 * i],
+					    free_index.max_len[2 * i + 1]);
+	return true;
+}
+
+/* Merges the empty entries of the image while recording them in the index. */
+static bool free_index_build(struct cbfs_image *image)
+{
+	struct cbfs_file *entry;
+
+	free_index_invalidate();
+	for (entry = cbfs_find_first_entry(image);
+	     entry && cbfs_is_valid_entry(image, entry);
+	     entry = cbfs_find_next_entry(image, entry)) {
+		cbfs_merge_empty_entry(image, entry, NULL);
+		if (ntohl(entry->type) != CBFS_TYPE_NULL)
+			continue;
+		if (!free_index_add(cbfs_get_entry_addr(image, entry),
+				    cbfs_get_entry_addr(image,
+					cbfs_find_next_entry(image, entry))))
+			return false;
+	}
+	if (!free_index_update_tree())
+		return false;
+
+	free_index.data = image->buffer.data;
+	free_index.size = image->buffer.size;
+	DEBUG("CBFS free space index: %zu extents\n", free_index.count);
+	return true;
+}
+
+static bool free_index_get(struct cbfs_image *image)
+{
+	if (free_index.data == image->buffer.data &&
+	    free_index.size == image->buffer.size)
+		return true;
+	return free_index_build(image);
+}
+
+/* Returns the first extent at or after 'from' with at least 'len' bytes. */
+static ssize_t free_index_find(size_t node, size_t lo, size_t hi, size_t from,
+			       uint32_t len)
+{
+	if (hi <= from || free_index.max_len[node] < len)
+		return -1;
+	if (hi - lo == 1)
+		return lo < free_index.count ? (ssize_t)lo : -1;
+
+	size_t mid = lo + (hi - lo) / 2;
+	ssize_t i = free_index_find(2 * node, lo, mid, from, len);
+	if (i < 0)
+		i = free_index_find(2 * node + 1, mid, hi, from, len);
+	return i;
+}
+
+static ssize_t free_index_first_fit(size_t from, uint32_t len)
+{
+	return free_index_find(1, 0, free_index.leaves, from, MAX(len, 1));
+}
+
+/* Returns the first extent that doesn't end below 'offset'. */
+static size_t free_index_lower_bound(uint32_t offset)
+{
+	size_t lo = 0, hi = free_index.count;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (free_index.extents[mid].end < offset)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+/* Returns the empty entry of an extent, or NULL if the index is out of date. */
+static struct cbfs_file *free_index_entry(struct cbfs_image *image, size_t i)
+{
+	const struct cbfs_free_extent *e = &free_index.extents[i];
+	struct cbfs_file *entry =
+		(struct cbfs_file *)(image->buffer.data + e->addr);
+
+	if (e->addr >= image->buffer.size ||
+	    !cbfs_is_valid_entry(image, entry) ||
+	    ntohl(entry->type) != CBFS_TYPE_NULL ||
+	    cbfs_get_entry_addr(image,
+				cbfs_find_next_entry(image, entry)) != e->end)
+		return NULL;
+	return entry;
+}
+
+/* Replaces extent i with the empty entries now found in its place. */
+static bool free_index_refill(struct cbfs_image *image, size_t i)
+{
+	struct cbfs_free_extent old = free_index.extents[i];
+	struct cbfs_free_extent found[3];
+	size_t count = 0;
+	struct cbfs_file *entry;
+
+	for (entry = (struct cbfs_file *)(image->buffer.data + old.addr);
+	     cbfs_get_entry_addr(image, entry) < old.end &&
+	     cbfs_is_valid_entry(image, entry);
+	     entry = cbfs_find_next_entry(image, entry)) {
+		if (ntohl(entry->type) != CBFS_TYPE_NULL)
+			continue;
+		if (count == ARRAY_SIZE(found)) {
+			free_index_invalidate();
+			return true;
+		}
+		found[count].addr = cbfs_get_entry_addr(image, entry);
+		found[count].end = cbfs_get_entry_addr(image,
+					cbfs_find_next_entry(image, entry));
+		count++;
+	}
+
+	if (!free_index_reserve(free_index.count + count))
+		return false;
+	memmove(&free_index.extents[i + count], &free_index.extents[i + 1],
+		(free_index.count - i - 1) * sizeof(*free_index.extents));
+	memcpy(&free_index.extents[i], found, count * sizeof(*found));
+	free_index.count = free_index.count - 1 + count;
+	return free_index_update_tree();
+}
+
 static const char *lookup_name_by_type(const struct typedesc_t *desc, uint32_t type,
 				const char *default_value)
 {
@@ -82,6 +295,7 @@ static int cbfs_fix_legacy_size(struct cbfs_image *image, char *hdr_loc)
 	// `cbfstool add-master-header` based image.
 
 	struct cbfs_file *entry, *first = NULL, *last = NULL;
+	free_index_invalidate();
 	for (first = entry = cbfs_find_first_entry(image);
 	     entry && cbfs_is_valid_entry(image, entry);
 	     entry = cbfs_find_next_entry(image, entry)) {
@@ -196,6 +410,8 @@ int cbfs_image_create(struct cbfs_image *image, size_t entries_size)
 	assert(image);
 	assert(image->buffer.data);
 
+	free_index_invalidate();
+
 	size_t empty_header_len = cbfs_calculate_file_header_size("");
 	uint32_t entries_offset = 0;
 	uint32_t align = CBFS_ALIGNMENT;
@@ -366,6 +582,7 @@ int cbfs_copy_instance(struct cbfs_image *image, struct buffer *dst)
 	size_t copy_end = buffer_size(dst);
 
 	align = CBFS_ALIGNMENT;
+	free_index_invalidate();
 
 	dst_entry = (struct cbfs_file *)buffer_get(dst);
 
@@ -420,6 +637,7 @@ int cbfs_expand_to_region(struct buffer *region)
 		ERROR("reading CBFS failed!\n");
 		return 1;
 	}
+	free_index_invalidate();
 
 	uint32_t region_sz = buffer_size(region);
 
@@ -459,6 +677,7 @@ int cbfs_truncate_space(struct buffer *region, uint32_t *size)
 		ERROR("reading CBFS failed!\n");
 		return 1;
 	}
+	free_index_invalidate();
 
 	struct cbfs_file *entry, *trailer;
 	for (trailer = entry = buffer_get(region);
@@ -510,6 +729,7 @@ int cbfs_compact_instance(struct cbfs_image *image)
 
 	/* The prev entry will always be an empty entry. */
 	prev = NULL;
+	free_index_invalidate();
 
 	/*
 	 * Note: this function does not honor alignment or fixed location files.
@@ -734,9 +954,8 @@ int cbfs_add_entry(struct cbfs_image *image, struct buffer *buffer,
 
 	const char *name = header->filename;
 
-	uint32_t entry_type;
 	uint32_t addr, addr_next;
-	struct cbfs_file *entry, *next;
+	struct cbfs_file *entry;
 	uint32_t need_size;
 	uint32_t header_size = ntohl(header->offset);
 
@@ -744,67 +963,68 @@ int cbfs_add_entry(struct cbfs_image *image, struct buffer *buffer,
 	DEBUG("cbfs_add_entry('%s'@0x%x) => need_size = %u+%zu=%u\n",
 	      name, content_offset, header_size, buffer->size, need_size);
 
-	// Merge empty entries.
+	// Merge empty entries and index the free space.
 	DEBUG("(trying to merge empty entries...)\n");
-	cbfs_legacy_walk(image, cbfs_merge_empty_entry, NULL);
-
-	for (entry = cbfs_find_first_entry(image);
-	     entry && cbfs_is_valid_entry(image, entry);
-	     entry = cbfs_find_next_entry(image, entry)) {
-
-		entry_type = ntohl(entry->type);
-		if (entry_type != CBFS_TYPE_NULL)
-			continue;
-
-		addr = cbfs_get_entry_addr(image, entry);
-		next = cbfs_find_next_entry(image, entry);
-		addr_next = cbfs_get_entry_addr(image, next);
-
-		DEBUG("cbfs_add_entry: space at 0x%x+0x%x(%d) bytes\n",
-		      addr, addr_next - addr, addr_next - addr);
-
-		/* Will the file fit? Don't yet worry if we have space for a new
-		 * "empty" entry. We take care of that later.
-		 */
-		if (addr + need_size > addr_next)
-			continue;
+	if (!free_index_get(image))
+		return -1;
 
-		// Test for complicated cases
-		if (content_offset > 0) {
-			if (addr_next < content_offset) {
-				DEBUG("Not for specified offset yet");
-				continue;
-			} else if (addr > content_offset) {
-				DEBUG("Exceed specified content_offset.");
-				break;
-			} else if (addr + header_size > content_offset) {
-				ERROR("Not enough space for header.\n");
-				break;
-			} else if (content_offset + buffer->size > addr_next) {
-				ERROR("Not enough space for content.\n");
-				break;
-			}
+	/* Will the file fit? Don't yet worry if we have space for a new
+	 * "empty" entry. We take care of that later.
+	 */
+	ssize_t i = free_index_first_fit(free_index_lower_bound(content_offset),
+					 need_size);
+	if (i >= 0 && !free_index_entry(image, i)) {
+		DEBUG("(rebuilding stale free space index...)\n");
+		if (!free_index_build(image))
+			return -1;
+		i = free_index_first_fit(free_index_lower_bound(content_offset),
+					 need_size);
+	}
+	if (i < 0)
+		goto fail;
+
+	entry = free_index_entry(image, i);
+	addr = free_index.extents[i].addr;
+	addr_next = free_index.extents[i].end;
+
+	DEBUG("cbfs_add_entry: space at 0x%x+0x%x(%d) bytes\n",
+	      addr, addr_next - addr, addr_next - addr);
+
+	// Test for complicated cases
+	if (content_offset > 0) {
+		if (addr > content_offset) {
+			DEBUG("Exceed specified content_offset.");
+			goto fail;
+		} else if (addr + header_size > content_offset) {
+			ERROR("Not enough space for header.\n");
+			goto fail;
+		} else if (content_offset + buffer->size > addr_next) {
+			ERROR("Not enough space for content.\n");
+			goto fail;
 		}
+	}
 
-		// TODO there are more few tricky cases that we may
-		// want to fit by altering offset.
+	// TODO there are more few tricky cases that we may
+	// want to fit by altering offset.
 
-		if (content_offset == 0) {
-			// we tested every condition earlier under which
-			// placing the file there might fail
-			content_offset = addr + header_size;
-		}
+	if (content_offset == 0) {
+		// we tested every condition earlier under which
+		// placing the file there might fail
+		content_offset = addr + header_size;
+	}
 
-		DEBUG("section 0x%x+0x%x for content_offset 0x%x.\n",
-		      addr, addr_next - addr, content_offset);
+	DEBUG("section 0x%x+0x%x for content_offset 0x%x.\n",
+	      addr, addr_next - addr, content_offset);
 
-		if (cbfs_add_entry_at(image, entry, buffer->data,
-				      content_offset, header, len_align) == 0) {
-			return 0;
-		}
-		break;
+	if (cbfs_add_entry_at(image, entry, buffer->data,
+			      content_offset, header, len_align) == 0) {
+		if (!free_index_refill(image, i))
+			free_index_invalidate();
+		return 0;
 	}
+	free_index_invalidate();
 
+fail:
 	ERROR("Could not add [%s, %zd bytes (%zd KB)@0x%x]; too big?\n",
 	      buffer->name, buffer->size, buffer->size / 1024, content_offset);
 	return -1;
@@ -1314,6 +1534,7 @@ int cbfs_remove_entry(struct cbfs_image *image, const char *name)
 	      entry->filename, cbfs_get_entry_addr(image, entry));
 	entry->type = htonl(CBFS_TYPE_DELETED);
 	cbfs_legacy_walk(image, cbfs_merge_empty_entry, NULL);
+	free_index_invalidate();
 	return 0;
 }
 
@@ -1914,7 +2135,6 @@ static size_t absolute_align(const struct cbfs_image *image, size_t val,
 int32_t cbfs_locate_entry(struct cbfs_image *image, size_t size,
 			  size_t page_size, size_t align, size_t metadata_size)
 {
-	struct cbfs_file *entry;
 	size_t need_len;
 	size_t addr, addr_next, addr2, addr3, offset;
 
@@ -1938,7 +2158,8 @@ int32_t cbfs_locate_entry(struct cbfs_image *image, size_t size,
 	need_len = metadata_size + size;
 
 	// Merge empty entries to build get max available space.
-	cbfs_legacy_walk(image, cbfs_merge_empty_entry, NULL);
+	if (!free_index_get(image))
+		return -1;
 
 	/* Three cases of content location on memory page:
 	 * case 1.
@@ -1961,19 +2182,19 @@ int32_t cbfs_locate_entry(struct cbfs_image *image, size_t size,
 	 * For stage targets, the address is also used to re-link stage before
 	 * being added into CBFS.
 	 */
-	for (entry = cbfs_find_first_entry(image);
-	     entry && cbfs_is_valid_entry(image, entry);
-	     entry = cbfs_find_next_entry(image, entry)) {
-
-		uint32_t type = ntohl(entry->type);
-		if (type != CBFS_TYPE_NULL)
+	for (ssize_t i = free_index_first_fit(0, need_len); i >= 0;
+	     i = free_index_first_fit(i + 1, need_len)) {
+		if (!free_index_entry(image, i)) {
+			DEBUG("(rebuilding stale free space index...)\n");
+			if (!free_index_build(image))
+				return -1;
+			/* Start over with the new index. */
+			i = -1;
 			continue;
+		}
 
-		addr = cbfs_get_entry_addr(image, entry);
-		addr_next = cbfs_get_entry_addr(image, cbfs_find_next_entry(
-				image, entry));
-		if (addr_next - addr < need_len)
-			continue;
+		addr = free_index.extents[i].addr;
+		addr_next = free_index.extents[i].end;
 
 		offset = absolute_align(image, addr + metadata_size, align);
 		if (is_in_same_page(offset, size, page_size) &&
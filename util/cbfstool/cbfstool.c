@@ -90,6 +90,7 @@ static struct param {
 	bool unprocessed;
 	bool ibb;
 	enum cbfs_compression compression;
+	bool compression_auto;
 	int precompression;
 	enum vb2_hash_algorithm hash;
 	/* For linux payloads */
@@ -561,7 +562,8 @@ static int do_cbfs_locate(uint32_t *cbfs_addr, size_t metadata_size,
 		if (param.baseaddress_assigned || param.stage_xip)
 			metadata_size += sizeof(struct cbfs_file_attr_position);
 	}
-	if (param.precompression || param.compression != CBFS_COMPRESS_NONE)
+	if (param.precompression || param.compression_auto ||
+	    param.compression != CBFS_COMPRESS_NONE)
 		metadata_size += sizeof(struct cbfs_file_attr_compression);
 
 	/* Take care of the hash attribute if it is used */
@@ -971,8 +973,155 @@ error:
 	return 1;
 }
 
-static int cbfstool_convert_raw(struct buffer *buffer,
-	unused uint32_t *offset, struct cbfs_file *header)
+/*
+ * Boot media and decompression throughput of the target in MB/s, used by
+ * `-c auto` to estimate how long a file takes to load. The defaults are rough
+ * numbers for an x86 platform booting from a 50 MHz SPI flash with caches
+ * enabled; use --load-profile with numbers measured on the target instead.
+ */
+static struct {
+	double flash;
+	double decompress[CBFS_COMPRESS_LZ4 + 1];
+} load_profile = {
+	.flash = 20,
+	.decompress = {
+		[CBFS_COMPRESS_LZMA] = 15,
+		[CBFS_COMPRESS_LZ4] = 400,
+	},
+};
+
+static const enum cbfs_compression auto_compression_algos[] = {
+	CBFS_COMPRESS_NONE,
+	CBFS_COMPRESS_LZ4,
+	CBFS_COMPRESS_LZMA,
+};
+
+/* Parses "flash=<MB/s>,lz4=<MB/s>,lzma=<MB/s>", all fields are optional. */
+static int parse_load_profile(const char *arg)
+{
+	char scratch[strlen(arg) + 1];
+	char *tok;
+
+	strcpy(scratch, arg);
+	for (tok = strtok(scratch, ","); tok; tok = strtok(NULL, ",")) {
+		char *value = strchr(tok, '=');
+		char *end;
+		double mbps;
+		int algo;
+
+		if (!value) {
+			ERROR("Missing '=' in load profile field '%s'\n", tok);
+			return -1;
+		}
+		*value++ = '\0';
+		mbps = strtod(value, &end);
+		if (*end || !(mbps > 0)) {
+			ERROR("Invalid throughput '%s' for '%s'\n", value, tok);
+			return -1;
+		}
+
+		if (!strcmp(tok, "flash")) {
+			load_profile.flash = mbps;
+			continue;
+		}
+		algo = cbfs_parse_comp_algo(tok);
+		if (algo <= CBFS_COMPRESS_NONE ||
+		    algo >= (int)ARRAY_SIZE(load_profile.decompress)) {
+			ERROR("Unknown load profile field '%s'\n", tok);
+			return -1;
+		}
+		load_profile.decompress[algo] = mbps;
+	}
+	return 0;
+}
+
+static const char *compression_name(enum cbfs_compression algo)
+{
+	for (size_t i = 0; types_cbfs_compression[i].name; i++)
+		if (types_cbfs_compression[i].type == algo)
+			return types_cbfs_compression[i].name;
+	return "unknown";
+}
+
+/* Estimated time in microseconds to load a file, 1 MB/s is 1 byte/us. */
+static double estimate_load_time(enum cbfs_compression algo, size_t stored,
+				 size_t decompressed)
+{
+	double us = stored / load_profile.flash;
+
+	if (algo != CBFS_COMPRESS_NONE)
+		us += decompressed / load_profile.decompress[algo];
+	return us;
+}
+
+static void report_auto_compression(enum cbfs_compression best,
+				    const double *estimate)
+{
+	LOG("%s: %s, estimated load time %.0f us (%.0f us less than uncompressed)\n",
+	    param.name, compression_name(best), estimate[best],
+	    estimate[CBFS_COMPRESS_NONE] - estimate[best]);
+	for (size_t i = 0; i < ARRAY_SIZE(auto_compression_algos); i++) {
+		enum cbfs_compression algo = auto_compression_algos[i];
+		if (estimate[algo] > 0)
+			INFO("  %-5s %10.0f us\n", compression_name(algo),
+			     estimate[algo]);
+	}
+}
+
+/* Lets the caller reject a compressed result, e.g. if it can't be used in-place. */
+typedef bool (*compression_check_t)(enum cbfs_compression algo,
+				    const char *data, size_t size, void *arg);
+
+/*
+ * Compresses the buffer with every algorithm and returns the one with the
+ * lowest estimated load time. The compressed data is returned in *compressed,
+ * or NULL if storing the data uncompressed is fastest.
+ */
+static enum cbfs_compression compress_auto(const struct buffer *buffer,
+		char **compressed, int *compressed_size,
+		compression_check_t check, void *arg)
+{
+	enum cbfs_compression best = CBFS_COMPRESS_NONE;
+	double estimate[ARRAY_SIZE(load_profile.decompress)] = { 0 };
+
+	*compressed = NULL;
+	*compressed_size = buffer->size;
+	estimate[best] = estimate_load_time(best, buffer->size, buffer->size);
+
+	for (size_t i = 0; i < ARRAY_SIZE(auto_compression_algos); i++) {
+		enum cbfs_compression algo = auto_compression_algos[i];
+		comp_func_ptr compress = compression_function(algo);
+		char *data;
+		int size;
+
+		if (algo == CBFS_COMPRESS_NONE || !compress)
+			continue;
+		data = calloc(buffer->size, 1);
+		if (!data)
+			break;
+		if (compress(buffer->data, buffer->size, data, &size) ||
+		    (check && !check(algo, data, size, arg))) {
+			free(data);
+			continue;
+		}
+
+		estimate[algo] = estimate_load_time(algo, size, buffer->size);
+		if (estimate[algo] < estimate[best]) {
+			best = algo;
+			free(*compressed);
+			*compressed = data;
+			*compressed_size = size;
+		} else {
+			free(data);
+		}
+	}
+
+	report_auto_compression(best, estimate);
+	return best;
+}
+
+static int cbfstool_compress(struct buffer *buffer, struct cbfs_file *header,
+			     compression_check_t check, void *arg)
 {
 	char *compressed;
 	int decompressed_size, compressed_size;
@@ -987,6 +1136,11 @@ static int cbfstool_convert_raw(struct buffer *buffer,
 		if (!compressed)
 			return -1;
 		memcpy(compressed, buffer->data + 8, compressed_size);
+	} else if (param.compression_auto) {
+		param.compression = compress_auto(buffer, &compressed,
+						  &compressed_size, check, arg);
+		if (!compressed)
+			goto out;
 	} else {
 		if (param.compression == CBFS_COMPRESS_NONE)
 			goto out;
@@ -1027,6 +1181,12 @@ out:
 	return 0;
 }
 
+static int cbfstool_convert_raw(struct buffer *buffer,
+	unused uint32_t *offset, struct cbfs_file *header)
+{
+	return cbfstool_compress(buffer, header, NULL, NULL);
+}
+
 static int cbfstool_convert_fsp(struct buffer *buffer,
 				uint32_t *offset, struct cbfs_file *header)
 {
@@ -1091,6 +1251,28 @@ static int cbfstool_convert_fsp(struct buffer *buffer,
 	return cbfstool_convert_raw(buffer, offset, header);
 }
 
+/* Rejects LZ4 for stages that can't be decompressed in-place, for `-c auto`. */
+static bool stage_lz4_check(enum cbfs_compression algo, const char *data,
+			    size_t size, void *arg)
+{
+	size_t memlen = *(size_t *)arg;
+	uint8_t *buf;
+	bool ok;
+
+	if (algo != CBFS_COMPRESS_LZ4)
+		return true;
+	if (size > memlen)
+		return false;
+
+	buf = malloc(memlen);
+	if (!buf)
+		return false;
+	memcpy(buf + memlen - size, data, size);
+	ok = ulz4fn(buf + memlen - size, size, buf, memlen) != 0;
+	free(buf);
+	return ok;
+}
+
 static int cbfstool_convert_mkstage(struct buffer *buffer, uint32_t *offset,
 	struct cbfs_file *header)
 {
@@ -1146,14 +1328,14 @@ static int cbfstool_convert_mkstage(struct buffer *buffer, uint32_t *offset,
 	uint32_t decmp_hash = XXH32(buffer_get(&output), decmp_size, 0);
 
 	/* Chain to base conversion routine to handle compression. */
-	ret = cbfstool_convert_raw(&output, offset, header);
+	size_t memlen = ntohl(stageheader->memlen);
+	ret = cbfstool_compress(&output, header, stage_lz4_check, &memlen);
 	if (ret != 0)
 		goto fail;
 
 	/* Special care must be taken for LZ4-compressed stages that the BSS is
 	   large enough to provide scratch space for in-place decompression. */
 	if (!param.precompression && param.compression == CBFS_COMPRESS_LZ4) {
-		size_t memlen = ntohl(stageheader->memlen);
 		size_t compressed_size = buffer_size(&output);
 		uint8_t *compare_buffer = malloc(memlen);
 		uint8_t *start = compare_buffer + memlen - compressed_size;
@@ -1185,29 +1367,91 @@ fail:
 	return -1;
 }
 
-static int cbfstool_convert_mkpayload(struct buffer *buffer,
-	unused uint32_t *offset, struct cbfs_file *header)
+typedef int (*payload_parser_t)(const struct buffer *input,
+		struct buffer *output, enum cbfs_compression algo,
+		struct cbfs_file *header);
+
+/*
+ * Payloads compress each segment on their own, so `-c auto` builds the payload
+ * with every algorithm. The uncompressed payload gives the decompressed size.
+ */
+static int parse_payload_auto(payload_parser_t parse,
+		const struct buffer *input, struct buffer *output,
+		struct cbfs_file *header)
+{
+	enum cbfs_compression best = CBFS_COMPRESS_NONE;
+	double estimate[ARRAY_SIZE(load_profile.decompress)] = { 0 };
+	struct buffer candidate;
+	size_t decompressed;
+
+	if (parse(input, output, CBFS_COMPRESS_NONE, header))
+		return -1;
+	decompressed = buffer_size(output);
+	estimate[best] = estimate_load_time(best, decompressed, decompressed);
+
+	for (size_t i = 0; i < ARRAY_SIZE(auto_compression_algos); i++) {
+		enum cbfs_compression algo = auto_compression_algos[i];
+
+		if (algo == CBFS_COMPRESS_NONE)
+			continue;
+		memset(&candidate, 0, sizeof(candidate));
+		if (parse(input, &candidate, algo, header)) {
+			buffer_delete(&candidate);
+			continue;
+		}
+
+		estimate[algo] = estimate_load_time(algo,
+				buffer_size(&candidate), decompressed);
+		if (estimate[algo] < estimate[best]) {
+			best = algo;
+			buffer_delete(output);
+			buffer_clone(output, &candidate);
+		} else {
+			buffer_delete(&candidate);
+		}
+	}
+
+	report_auto_compression(best, estimate);
+	return 0;
+}
+
+static int parse_payload(const struct buffer *buffer, struct buffer *output,
+			 enum cbfs_compression algo, struct cbfs_file *header)
 {
-	struct buffer output;
 	int ret;
 	/* Per default, try and see if payload is an ELF binary */
-	ret = parse_elf_to_payload(buffer, &output, param.compression);
+	ret = parse_elf_to_payload(buffer, output, algo);
 
 	/* If it's not an ELF, see if it's a FIT */
 	if (ret != 0) {
-		ret = parse_fit_to_payload(buffer, &output, param.compression);
+		ret = parse_fit_to_payload(buffer, output, algo);
 		if (ret == 0)
 			header->type = htonl(CBFS_TYPE_FIT);
 	}
 
 	/* If it's not an FIT, see if it's a UEFI FV */
 	if (ret != 0)
-		ret = parse_fv_to_payload(buffer, &output, param.compression);
+		ret = parse_fv_to_payload(buffer, output, algo);
 
 	/* If it's neither ELF nor UEFI Fv, try bzImage */
 	if (ret != 0)
-		ret = parse_bzImage_to_payload(buffer, &output,
-				param.initrd, param.cmdline, param.compression);
+		ret = parse_bzImage_to_payload(buffer, output,
+				param.initrd, param.cmdline, algo);
+
+	return ret;
+}
+
+static int cbfstool_convert_mkpayload(struct buffer *buffer,
+	unused uint32_t *offset, struct cbfs_file *header)
+{
+	struct buffer output;
+	int ret;
+
+	if (param.compression_auto)
+		ret = parse_payload_auto(parse_payload, buffer, &output,
+					 header);
+	else
+		ret = parse_payload(buffer, &output, param.compression, header);
 
 	/* Not a supported payload type */
 	if (ret != 0) {
@@ -1223,16 +1467,29 @@ static int cbfstool_convert_mkpayload(struct buffer *buffer,
 	return 0;
 }
 
+static int parse_flat_payload(const struct buffer *buffer,
+			      struct buffer *output, enum cbfs_compression algo,
+			      unused struct cbfs_file *header)
+{
+	return parse_flat_binary_to_payload(buffer, output, param.loadaddress,
+					    param.entrypoint, algo);
+}
+
 static int cbfstool_convert_mkflatpayload(struct buffer *buffer,
 	unused uint32_t *offset, struct cbfs_file *header)
 {
 	struct buffer output;
-	if (parse_flat_binary_to_payload(buffer, &output,
-					 param.loadaddress,
-					 param.entrypoint,
-					 param.compression) != 0) {
+	int ret;
+
+	if (param.compression_auto)
+		ret = parse_payload_auto(parse_flat_payload, buffer, &output,
+					 header);
+	else
+		ret = parse_flat_payload(buffer, &output, param.compression,
+					 header);
+	if (ret != 0)
 		return -1;
-	}
+
 	buffer_delete(buffer);
 	// Direct assign, no dupe.
 	memcpy(buffer, &output, sizeof(*buffer));
@@ -1240,6 +1497,165 @@ static int cbfstool_convert_mkflatpayload(struct buffer *buffer,
 	return 0;
 }
 
+/* Intel microcode update header, see the SDM vol. 3 chapter 9.11. */
+struct mcu_header {
+	uint32_t header_version;
+	uint32_t revision;
+	uint32_t date;
+	uint32_t sig;
+	uint32_t checksum;
+	uint32_t loader_revision;
+	uint32_t pf;
+	uint32_t data_size;
+	uint32_t total_size;
+	uint32_t reserved[3];
+} __packed;
+
+struct mcu_ext_sig_table {
+	uint32_t count;
+	uint32_t checksum;
+	uint32_t reserved[3];
+	struct {
+		uint32_t sig;
+		uint32_t pf;
+		uint32_t checksum;
+	} __packed entries[];
+} __packed;
+
+static bool mcu_index_add(struct cbfs_mcu_index_entry *entries, size_t *count,
+			  size_t max_entries, uint32_t sig, uint32_t pf,
+			  size_t offset)
+{
+	if (*count == max_entries || pf > 0xff ||
+	    offset > CBFS_MCU_INDEX_MAX_OFFSET)
+		return false;
+
+	entries[*count].sig = htonl(sig);
+	entries[*count].pf_offset = htonl(CBFS_MCU_INDEX_PF_OFFSET(pf, offset));
+	(*count)++;
+	return true;
+}
+
+/*
+ * Collect the signatures of all updates in a blob of concatenated Intel
+ * microcode updates, in blob order so that a lookup finds the same update as
+ * a linear scan. Returns the number of entries or -1 if the blob can't be
+ * indexed.
+ */
+static int mcu_index_build(const struct buffer *buffer,
+			   struct cbfs_mcu_index_entry *entries,
+			   size_t max_entries)
+{
+	const uint8_t *data = (const uint8_t *)buffer_get(buffer);
+	const size_t size = buffer_size(buffer);
+	size_t offset = 0, count = 0;
+
+	while (size - offset >= sizeof(struct mcu_header)) {
+		const struct mcu_header *mcu = (const void *)(data + offset);
+		uint32_t data_size = mcu->data_size ?: 2000;
+		uint32_t total_size = mcu->total_size ?: 2048;
+
+		/* Anything else than a valid update must be padding. */
+		if (mcu->header_version != 1 || mcu->loader_revision != 1 ||
+		    total_size > size - offset ||
+		    total_size < sizeof(*mcu) + data_size)
+			break;
+
+		if (!mcu_index_add(entries, &count, max_entries, mcu->sig,
+				   mcu->pf, offset))
+			return -1;
+
+		if (mcu->total_size >= sizeof(*mcu) + data_size +
+				       sizeof(struct mcu_ext_sig_table)) {
+			const struct mcu_ext_sig_table *ext = (const void *)
+				(data + offset + sizeof(*mcu) + data_size);
+			uint32_t i;
+
+			if (ext->count > (total_size - sizeof(*mcu) - data_size -
+					  sizeof(*ext)) / sizeof(ext->entries[0]))
+				return -1;
+
+			for (i = 0; i < ext->count; i++) {
+				if (!mcu_index_add(entries, &count, max_entries,
+						   ext->entries[i].sig,
+						   ext->entries[i].pf, offset))
+					return -1;
+			}
+		}
+
+		offset += total_size;
+	}
+
+	if (!count)
+		return -1;
+
+	for (; offset < size; offset++) {
+		if (data[offset] != 0 && data[offset] != 0xff)
+			return -1;
+	}
+
+	return count;
+}
+
+/*
+ * Index microcode blobs by processor signature so that the update for the
+ * running CPU can be found without walking the whole blob. The index is a
+ * file attribute because FIT entries point into the file data, which thus
+ * must stay unchanged.
+ */
+static int cbfstool_convert_microcode(struct buffer *buffer,
+	uint32_t *offset, struct cbfs_file *header)
+{
+	struct cbfs_mcu_index_entry entries[CBFS_METADATA_MAX_SIZE /
+					    sizeof(struct cbfs_mcu_index_entry)];
+	struct cbfs_file_attr_mcu_index *index;
+	size_t reserved = ntohl(header->offset) + sizeof(*index);
+	size_t max_entries, attr_size;
+	int count;
+
+	/* Leave room for the attributes that are added after this one. */
+	if (param.hash != VB2_HASH_INVALID)
+		reserved += cbfs_file_attr_hash_size(param.hash);
+	if (param.compression_auto || param.compression != CBFS_COMPRESS_NONE)
+		reserved += sizeof(struct cbfs_file_attr_compression);
+	if (param.autogen_attr)
+		reserved += sizeof(struct cbfs_file_attr_align) +
+			    sizeof(struct cbfs_file_attr_position);
+	if (param.ibb)
+		reserved += sizeof(struct cbfs_file_attribute);
+	if (param.padding)
+		reserved += ALIGN_UP(MAX(sizeof(struct cbfs_file_attribute),
+					 param.padding), CBFS_ATTRIBUTE_ALIGN);
+	if (reserved >= CBFS_METADATA_MAX_SIZE)
+		goto raw;
+
+	max_entries = (CBFS_METADATA_MAX_SIZE - reserved) /
+		      sizeof(index->entries[0]);
+
+	count = mcu_index_build(buffer, entries, max_entries);
+	if (count < 0) {
+		INFO("Not indexing microcode '%s'.\n", param.name);
+		goto raw;
+	}
+	attr_size = sizeof(*index) + count * sizeof(entries[0]);
+
+	/* Locate again to take the index into account, as for stages. */
+	if (param.alignment && do_cbfs_locate(offset, attr_size, 0)) {
+		ERROR("Could not find location for microcode.\n");
+		return 1;
+	}
+
+	index = (void *)cbfs_add_file_attr(header, CBFS_FILE_ATTR_TAG_MCU_INDEX,
+					   attr_size);
+	if (!index)
+		return -1;
+	memcpy(index->entries, entries, count * sizeof(entries[0]));
+	INFO("Indexed %d microcode signatures.\n", count);
+
+raw:
+	return cbfstool_convert_raw(buffer, offset, header);
+}
+
 static int cbfs_add(void)
 {
 	convert_buffer_t convert = cbfstool_convert_raw;
@@ -1250,6 +1666,8 @@ static int cbfs_add(void)
 		if (!param.baseaddress_assigned)
 			param.alignment = 4*1024;
 		convert = cbfstool_convert_fsp;
+	} else if (param.type == CBFS_TYPE_MICROCODE) {
+		convert = cbfstool_convert_microcode;
 	} else if (param.stage_xip) {
 		ERROR("cbfs add supports xip only for FSP component type\n");
 		return 1;
@@ -1270,7 +1688,8 @@ static int cbfs_add_stage(void)
 			return 1;
 		}
 
-		if (param.compression != CBFS_COMPRESS_NONE) {
+		if (param.compression_auto ||
+		    param.compression != CBFS_COMPRESS_NONE) {
 			ERROR("Cannot specify compression for XIP.\n");
 			return 1;
 		}
@@ -1748,6 +2167,7 @@ enum {
 	LONGOPT_IBB = LONGOPT_START,
 	LONGOPT_EXT_WIN_BASE,
 	LONGOPT_EXT_WIN_SIZE,
+	LONGOPT_LOAD_PROFILE,
 	LONGOPT_END,
 };
 
@@ -1793,6 +2213,7 @@ static struct option long_options[] = {
 	{"ibb",           no_argument,       0, LONGOPT_IBB },
 	{"ext-win-base",  required_argument, 0, LONGOPT_EXT_WIN_BASE },
 	{"ext-win-size",  required_argument, 0, LONGOPT_EXT_WIN_SIZE },
+	{"load-profile",  required_argument, 0, LONGOPT_LOAD_PROFILE },
 	{NULL,            0,                 0,  0  }
 };
 
@@ -1899,6 +2320,8 @@ static void usage(char *name)
 	     "                   space(x86 only)\n"
 	     "  --ext-win-size   Size of extended decode window in host address\n"
 	     "                   space(x86 only)\n"
+	     "  --load-profile   Throughput in MB/s used by -c auto, e.g.\n"
+	     "                   flash=20,lzma=15,lz4=400\n"
 	     "COMMANDs:\n"
 	     " add [-r image,regions] -f FILE -n NAME -t TYPE [-A hash] \\\n"
 	     "        [-c compression] [-b base-address | -a alignment] \\\n"
@@ -1960,6 +2383,9 @@ static void usage(char *name)
 	     "  in two possible formats: if their value is greater than\n"
 	     "  0x80000000, they are interpreted as a top-aligned x86 memory\n"
 	     "  address; otherwise, they are treated as an offset into flash.\n"
+	     "ENVIRONMENT:\n"
+	     "  CBFSTOOL_COMPRESSION_CACHE  Directory to cache compressed\n"
+	     "  data in, so unchanged files are not compressed again\n"
 	     "ARCHes:\n", name, name
 	    );
 	print_supported_architectures();
@@ -1967,6 +2393,9 @@ static void usage(char *name)
 	printf("TYPEs:\n");
 	print_supported_filetypes();
 	printf(
+	     "\nCompression 'auto' tries every algorithm and keeps the one\n"
+	     "with the lowest estimated load time (read from flash plus\n"
+	     "decompression) according to --load-profile.\n"
 	     "\n* Note that these actions and switches are only valid when\n"
 	     "  working with legacy images whose structure is described\n"
 	     "  primarily by a CBFS master header. New-style images, in\n"
@@ -2062,6 +2491,10 @@ int main(int argc, char **argv)
 					param.precompression = 1;
 					break;
 				}
+				if (strcmp(optarg, "auto") == 0) {
+					param.compression_auto = true;
+					break;
+				}
 				int algo = cbfs_parse_comp_algo(optarg);
 				if (algo >= 0)
 					param.compression = algo;
@@ -2259,6 +2692,10 @@ int main(int argc, char **argv)
 					return 1;
 				}
 				break;
+			case LONGOPT_LOAD_PROFILE:
+				if (parse_load_profile(optarg))
+					return 1;
+				break;
 			case 'h':
 			case '?':
 				usage(argv[0]);
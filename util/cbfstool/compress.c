@@ -1,11 +1,15 @@
 /* compression handling for cbfstool */
 /* SPDX-License-Identifier: GPL-2.0-only */
 
+#include <errno.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "common.h"
 #include "lz4/lib/lz4frame.h"
+#include "lz4/lib/xxhash.h"
 #include <commonlib/bsd/compression.h>
 
 static int lz4_compress(char *in, int in_len, char *out, int *out_len)
@@ -66,18 +70,192 @@ static int none_decompress(char *in, int in_len, char *out, unused int out_len,
 	return 0;
 }
 
+/*
+ * Optional on-disk cache of compressor outputs, enabled by pointing
+ * CBFSTOOL_COMPRESSION_CACHE at a directory. Entries are keyed by the input
+ * data, the algorithm and its parameters, so unchanged stages and blobs don't
+ * need to be compressed again on every build. Bump the parameter string of an
+ * algorithm whenever its output changes.
+ */
+#define COMPRESSION_CACHE_ENV "CBFSTOOL_COMPRESSION_CACHE"
+#define COMPRESSION_CACHE_MAGIC "CBFSCMP2"
+
+struct cached_compressor {
+	const char *name;
+	const char *params;
+	comp_func_ptr compress;
+};
+
+static const struct cached_compressor cached_lz4 = {
+	"lz4", "hc20-max4MB-independent", lz4_compress,
+};
+
+static const struct cached_compressor cached_lzma = {
+	"lzma", "lc1-lp0-pb0-fb273-bt4", lzma_compress,
+};
+
+struct compression_cache_entry {
+	char magic[8];
+	/* Hash of the input with a different seed, to rule out key collisions */
+	uint64_t check;
+	/* Hash of the compressed data following the entry */
+	uint64_t out_hash;
+	uint32_t in_len;
+	uint32_t out_len;
+	int32_t result;
+};
+
+static struct {
+	const char *dir;
+	bool initialized;
+	unsigned int hits;
+	unsigned int misses;
+} compression_cache;
+
+static void compression_cache_print_stats(void)
+{
+	if (compression_cache.hits + compression_cache.misses)
+		LOG("Compression cache: %u hits, %u misses\n",
+		    compression_cache.hits, compression_cache.misses);
+}
+
+static const char *compression_cache_dir(void)
+{
+	if (compression_cache.initialized)
+		return compression_cache.dir;
+	compression_cache.initialized = true;
+
+	const char *dir = getenv(COMPRESSION_CACHE_ENV);
+	if (!dir || !*dir)
+		return NULL;
+	if (mkdir(dir, 0755) && errno != EEXIST) {
+		WARN("Can't create compression cache %s: %s\n", dir,
+		     strerror(errno));
+		return NULL;
+	}
+
+	compression_cache.dir = dir;
+	atexit(compression_cache_print_stats);
+	return dir;
+}
+
+static bool compression_cache_read(const char *path,
+		const struct compression_cache_entry *key, char *out,
+		int *out_len, int *result)
+{
+	struct compression_cache_entry entry;
+	bool hit = false;
+	FILE *fp = fopen(path, "rb");
+
+	if (!fp)
+		return false;
+	if (fread(&entry, sizeof(entry), 1, fp) == 1 &&
+	    !memcmp(entry.magic, key->magic, sizeof(entry.magic)) &&
+	    entry.check == key->check && entry.in_len == key->in_len &&
+	    entry.out_len <= entry.in_len) {
+		if (entry.result)
+			hit = true;
+		else
+			hit = fread(out, 1, entry.out_len, fp) == entry.out_len &&
+			      XXH64(out, entry.out_len, 0) == entry.out_hash;
+	}
+	fclose(fp);
+
+	if (hit) {
+		*out_len = entry.out_len;
+		*result = entry.result;
+	}
+	return hit;
+}
+
+/* Entries are written to a temporary file first, so readers never see a partial one. */
+static void compression_cache_write(const char *dir, const char *path,
+		const struct compression_cache_entry *entry, const char *out)
+{
+	char tmp[strlen(dir) + sizeof("/.tmp-XXXXXX")];
+	int fd;
+	FILE *fp;
+	bool ok;
+
+	snprintf(tmp, sizeof(tmp), "%s/.tmp-XXXXXX", dir);
+	fd = mkstemp(tmp);
+	if (fd < 0)
+		return;
+	fchmod(fd, 0644);
+	fp = fdopen(fd, "wb");
+	if (!fp) {
+		close(fd);
+		unlink(tmp);
+		return;
+	}
+
+	ok = fwrite(entry, sizeof(*entry), 1, fp) == 1;
+	if (ok && !entry->result)
+		ok = fwrite(out, 1, entry->out_len, fp) == entry->out_len;
+	ok = !fclose(fp) && ok;
+	if (!ok || rename(tmp, path)) {
+		WARN("Can't write compression cache entry %s\n", path);
+		unlink(tmp);
+	}
+}
+
+static int cached_compress(const struct cached_compressor *comp, char *in,
+			   int in_len, char *out, int *out_len)
+{
+	const char *dir = compression_cache_dir();
+	struct compression_cache_entry entry = { .in_len = in_len };
+	int result;
+
+	if (!dir || in_len < 0)
+		return comp->compress(in, in_len, out, out_len);
+
+	uint64_t seed = XXH64(comp->params, strlen(comp->params), 0);
+	uint64_t key = XXH64(in, in_len, seed);
+	entry.check = XXH64(in, in_len, ~seed);
+	memcpy(entry.magic, COMPRESSION_CACHE_MAGIC, sizeof(entry.magic));
+
+	char path[strlen(dir) + strlen(comp->name) + 32];
+	snprintf(path, sizeof(path), "%s/%s-%016llx", dir, comp->name,
+		 (unsigned long long)key);
+
+	if (compression_cache_read(path, &entry, out, out_len, &result)) {
+		compression_cache.hits++;
+		return result;
+	}
+
+	compression_cache.misses++;
+	result = comp->compress(in, in_len, out, out_len);
+	entry.result = result;
+	entry.out_len = result ? 0 : *out_len;
+	entry.out_hash = XXH64(out, entry.out_len, 0);
+	compression_cache_write(dir, path, &entry, out);
+	return result;
+}
+
+static int lz4_compress_cached(char *in, int in_len, char *out, int *out_len)
+{
+	return cached_compress(&cached_lz4, in, in_len, out, out_len);
+}
+
+static int lzma_compress_cached(char *in, int in_len, char *out, int *out_len)
+{
+	return cached_compress(&cached_lzma, in, in_len, out, out_len);
+}
+
 comp_func_ptr compression_function(enum cbfs_compression algo)
 {
 	comp_func_ptr compress;
+	bool cache = compression_cache_dir() != NULL;
+
 	switch (algo) {
 	case CBFS_COMPRESS_NONE:
 		compress = none_compress;
 		break;
 	case CBFS_COMPRESS_LZMA:
-		compress = lzma_compress;
+		compress = cache ? lzma_compress_cached : lzma_compress;
 		break;
 	case CBFS_COMPRESS_LZ4:
-		compress = lz4_compress;
+		compress = cache ? lz4_compress_cached : lz4_compress;
 		break;
 	default:
 		ERROR("Unknown compression algorithm %d!\n", algo);
@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "batch.h"
 #include "common.h"
 
 /*
@@ -33,8 +34,13 @@ static struct param {
 	const char *image_name;
 	bool dir_ops;
 	const char *dentry_name;
+	unsigned int jobs;
 } param;
 
+/* argv[0], and whether this process builds a variant of a batch */
+static char *prog_name;
+static bool batch_variant;
+
 struct bpdt_header {
 	/*
 	 * This is used to identify start of BPDT. It should always be
@@ -1858,8 +1864,41 @@ struct command {
 	enum ifwi_ret (*function)(void);
 };
 
+int main(int argc, char **argv);
+
+/*
+ * Runs in a child forked by ifwi_batch(), which has parsed the image already.
+ * The variant is built like a regular command line "OUTPUT COMMAND ...".
+ */
+static int ifwi_batch_variant(int argc, char *argv[], unused void *arg)
+{
+	memset(&param, 0, sizeof(param));
+	batch_variant = true;
+	return main(argc, argv);
+}
+
+static enum ifwi_ret ifwi_batch(void)
+{
+	if (!param.file_name) {
+		ERROR("%s: -f option required\n", __func__);
+		return COMMAND_ERR;
+	}
+
+	if (batch_variant) {
+		ERROR("%s: batches can't be nested\n", __func__);
+		return COMMAND_ERR;
+	}
+
+	if (batch_run(param.file_name, prog_name, param.jobs,
+		      ifwi_batch_variant, NULL))
+		return COMMAND_ERR;
+
+	return NO_ACTION_REQUIRED;
+}
+
 static const struct command commands[] = {
 	{"add", "f:n:e:dsvh?", ifwi_add},
+	{"batch", "f:j:svh?", ifwi_batch},
 	{"create", "f:svh?", ifwi_create},
 	{"delete", "f:n:svh?", ifwi_delete},
 	{"extract", "f:n:e:dsvh?", ifwi_extract},
@@ -1871,6 +1910,7 @@ static struct option long_options[] = {
 	{"subpart_dentry",  required_argument, 0, 'e'},
 	{"file",	    required_argument, 0, 'f'},
 	{"help",	    required_argument, 0, 'h'},
+	{"jobs",	    required_argument, 0, 'j'},
 	{"name",	    required_argument, 0, 'n'},
 	{"dir_ops",         no_argument,       0, 'd'},
 	{"verbose",	    no_argument,       0, 'v'},
@@ -1886,6 +1926,7 @@ static void usage(const char *name)
 	       " %s FILE COMMAND [PARAMETERS]\n\n"
 	       "COMMANDs:\n"
 	       " add -f FILE -n NAME [-d -e ENTRY] [-s]\n"
+	       " batch -f MANIFEST [-j JOBS] [-s]\n"
 	       " create -f FILE [-s]\n"
 	       " delete -n NAME [-s]\n"
 	       " extract -f FILE -n NAME [-d -e ENTRY] [-s]\n"
@@ -1898,7 +1939,11 @@ static void usage(const char *name)
 	       " -e ENTRY: Name of directory entry to operate on\n"
 	       " -v      : Verbose level\n"
 	       " -h      : Help message\n"
-	       " -n NAME : Name of sub-partition to operate on\n",
+	       " -n NAME : Name of sub-partition to operate on\n"
+	       " -j JOBS : Number of variants to build at once (default: one\n"
+	       "           per CPU)\n\n"
+	       "batch parses FILE once and builds a variant of it for each line\n"
+	       "of MANIFEST, written as \"OUTPUT COMMAND [PARAMETERS]\".\n",
 	       name, name
 	       );
 
@@ -1916,6 +1961,7 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
+	prog_name = argv[0];
 	param.image_name = argv[1];
 	param.logical_boot_partition = LBP1;
 	char *cmd = argv[2];
@@ -1961,6 +2007,9 @@ int main(int argc, char **argv)
 			case 'e':
 				param.dentry_name = optarg;
 				break;
+			case 'j':
+				param.jobs = strtoul(optarg, NULL, 0);
+				break;
 			case 'v':
 				verbose++;
 				break;
@@ -1973,7 +2022,8 @@ int main(int argc, char **argv)
 			}
 		}
 
-		if (ifwi_parse()) {
+		/* A batch variant starts from the image parsed by the batch. */
+		if (!batch_variant && ifwi_parse()) {
 			ERROR("%s: ifwi parsing failed\n", argv[0]);
 			return 1;
 		}
@@ -143,6 +143,12 @@ int do_lzma_compress(char *in, int in_len, char *out, int *out_len)
 
 	res = LzmaEnc_Encode(p, &os, &is, 0, &LZMAalloc, &LZMAalloc);
 	LzmaEnc_Destroy(p, &LZMAalloc, &LZMAalloc);
+	/*
+	 * The output didn't fit in in_len bytes. That's expected for
+	 * incompressible data and callers store it uncompressed then.
+	 */
+	if (res == SZ_ERROR_WRITE && outstream.pos == outstream.size)
+		return -1;
 	if (res != SZ_OK) {
 		ERROR("LZMA: LzmaEnc_Encode failed %d.\n", res);
 		return -1;
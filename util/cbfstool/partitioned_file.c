@@ -11,13 +11,110 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 struct partitioned_file {
 	struct fmap *fmap;
 	struct buffer buffer;
 	FILE *stream;
+	/*
+	 * Read-only shared mapping of the backing file, or NULL if the buffer
+	 * was read into memory. In the former case the buffer is a private
+	 * (copy-on-write) mapping of the same file, so comparing the two shows
+	 * which parts of the image have been modified.
+	 */
+	char *disk;
 };
 
+/*
+ * Map an existing image instead of reading it into memory. The image is only
+ * paged in as it's accessed and, since the mapping is private, changes don't
+ * reach the file until partitioned_file_write_region() is called for them.
+ */
+static bool map_flat_file(struct partitioned_file *file, const char *filename)
+{
+	int fd = fileno(file->stream);
+	struct stat st;
+	void *data, *disk;
+
+	if (fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size <= 0)
+		return false;
+
+	data = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+		return false;
+	disk = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (disk == MAP_FAILED) {
+		munmap(data, st.st_size);
+		return false;
+	}
+
+	file->buffer.name = strdup(filename);
+	file->buffer.data = data;
+	file->buffer.offset = 0;
+	file->buffer.size = st.st_size;
+	file->disk = disk;
+	return true;
+}
+
+static void unmap_flat_file(struct partitioned_file *file)
+{
+	munmap(file->buffer.data, file->buffer.size);
+	munmap(file->disk, file->buffer.size);
+	file->disk = NULL;
+	free(file->buffer.name);
+	file->buffer.name = NULL;
+	file->buffer.data = NULL;
+	file->buffer.size = 0;
+}
+
+/*
+ * Write back the pages of [offset, offset + size) that differ from the file.
+ * Untouched pages of the private mapping still share the page cache with the
+ * read-only one, so comparing them is cheap compared to rewriting them.
+ */
+static bool write_back_dirty(struct partitioned_file *file, size_t offset,
+								size_t size)
+{
+	const size_t page = sysconf(_SC_PAGESIZE);
+	const size_t end = offset + size;
+	size_t written = 0;
+	size_t start, next;
+
+	for (start = offset; start < end; start = next) {
+		next = MIN(ALIGN_UP(start + 1, page), end);
+		if (!memcmp(file->buffer.data + start, file->disk + start,
+							next - start))
+			continue;
+
+		/* Extend the dirty range over all following modified pages. */
+		while (next < end) {
+			size_t chunk = MIN(next + page, end) - next;
+			if (!memcmp(file->buffer.data + next, file->disk + next,
+									chunk))
+				break;
+			next += chunk;
+		}
+
+		for (size_t pos = start; pos < next;) {
+			ssize_t ret = pwrite(fileno(file->stream),
+				file->buffer.data + pos, next - pos, pos);
+			if (ret <= 0) {
+				ERROR("Failed to write to image file\n");
+				return false;
+			}
+			pos += ret;
+		}
+		written += next - start;
+	}
+
+	DEBUG("Wrote back %zu of %zu bytes at offset %#zx\n", written, size,
+									offset);
+	return true;
+}
+
 static bool fill_ones_through(struct partitioned_file *file)
 {
 	assert(file);
@@ -52,11 +149,6 @@ static partitioned_file_t *reopen_flat_file(const char *filename,
 		return NULL;
 	}
 
-	if (buffer_from_file(&file->buffer, filename)) {
-		free(file);
-		return NULL;
-	}
-
 	access_mode = write_access ?  "rb+" : "rb";
 	file->stream = fopen(filename, access_mode);
 
@@ -66,6 +158,13 @@ static partitioned_file_t *reopen_flat_file(const char *filename,
 		return NULL;
 	}
 
+	/* Fall back to reading the file for anything that can't be mapped. */
+	if (!map_flat_file(file, filename) &&
+	    buffer_from_file(&file->buffer, filename)) {
+		partitioned_file_close(file);
+		return NULL;
+	}
+
 	return file;
 }
 
@@ -220,6 +319,9 @@ bool partitioned_file_write_region(partitioned_file_t *file,
 		return false;
 	}
 
+	if (file->disk)
+		return write_back_dirty(file, buffer->offset, buffer->size);
+
 	if (fseek(file->stream, buffer->offset, SEEK_SET)) {
 		ERROR("Failed to seek within image file\n");
 		return false;
@@ -269,7 +371,10 @@ void partitioned_file_close(partitioned_file_t *file)
 		return;
 
 	file->fmap = NULL;
-	buffer_delete(&file->buffer);
+	if (file->disk)
+		unmap_flat_file(file);
+	else
+		buffer_delete(&file->buffer);
 	if (file->stream) {
 		flock(fileno(file->stream), LOCK_UN);
 		fclose(file->stream);
@@ -51,10 +51,13 @@ partitioned_file_t *partitioned_file_create(const char *filename,
 
 /**
  * Read a file back in from the disk.
- * An in-memory buffer is created and populated with the file's
- * contents. If the image contains an FMAP, it will be opened as a
- * full partitioned file; otherwise, it will be opened as a flat file as
- * if it had been created by partitioned_file_create_flat().
+ * The file is mapped into a private, copy-on-write buffer where possible, so
+ * only the parts of the image that are accessed are read and modifications
+ * don't reach the file until they're written back; otherwise an in-memory
+ * buffer is populated with the file's contents. If the image contains an
+ * FMAP, it will be opened as a full partitioned file; otherwise, it will be
+ * opened as a flat file as if it had been created by
+ * partitioned_file_create_flat().
  * The partitioned_file_t returned from this function is separately owned by the
  * caller, and must later be passed to partitioned_file_close();
  *
@@ -70,7 +73,9 @@ partitioned_file_t *partitioned_file_reopen(const char *filename,
  * This function should only be called on buffers originally retrieved by a call
  * to partitioned_file_read_region() on the same partitioned file object. The
  * contents of this buffer are copied back to the same region of the buffer and
- * backing file that the region occupied before.
+ * backing file that the region occupied before. For files opened with
+ * partitioned_file_reopen(), only the pages that differ from the backing file
+ * are written.
  *
  * @param file   Partitioned file to which to write the data
  * @param buffer Modified buffer obtained from partitioned_file_read_region()
@@ -20,6 +20,7 @@
 #include <commonlib/cbmem_id.h>
 #include <commonlib/timestamp_serialized.h>
 #include <commonlib/tcpa_log_serialized.h>
+#include <commonlib/smi_latency_serialized.h>
 #include <commonlib/coreboot_tables.h>
 
 #ifdef __OpenBSD__
@@ -43,17 +44,28 @@ struct mapping {
 	size_t virt_size;
 	unsigned long long phys;
 	size_t size;
+	/* Points into a window instead of being mmap()ed on its own. */
+	int borrowed;
 };
 
-#define CBMEM_VERSION "1.1"
+#define CBMEM_VERSION "1.2"
 
 /* verbose output? */
 static int verbose = 0;
 #define debug(x...) if(verbose) printf(x)
 
 /* File handle used to access /dev/mem */
-static int mem_fd;
+static int mem_fd = -1;
 static struct mapping lbtable_mapping;
+static u64 lbtable_header_addr;
+
+/*
+ * Memory that is mapped already, i.e. all of CBMEM or the records of a
+ * snapshot. map_memory() serves requests within a window without mapping
+ * them again.
+ */
+static struct mapping windows[8];
+static size_t num_windows;
 
 static void die(const char *msg)
 {
@@ -88,6 +100,22 @@ static const void *mapping_virt(const struct mapping *mapping)
 	return v + mapping->offset;
 }
 
+/* Returns the virtual address of [phys, phys + sz) if a window covers it. */
+static const void *window_lookup(unsigned long long phys, size_t sz)
+{
+	for (size_t i = 0; i < num_windows; i++) {
+		const struct mapping *w = &windows[i];
+
+		if (phys < w->phys || phys - w->phys > w->size ||
+		    sz > w->size - (phys - w->phys))
+			continue;
+
+		return (const u8 *)mapping_virt(w) + (phys - w->phys);
+	}
+
+	return NULL;
+}
+
 /* Returns virtual address on success, NULL on error. mapping is filled in. */
 static const void *map_memory(struct mapping *mapping, unsigned long long phys,
 				size_t sz)
@@ -95,9 +123,21 @@ static const void *map_memory(struct mapping *mapping, unsigned long long phys,
 	void *v;
 	unsigned long long page_size;
 
+	v = (void *)window_lookup(phys, sz);
+	if (v) {
+		mapping->virt = v;
+		mapping->offset = 0;
+		mapping->virt_size = sz;
+		mapping->size = sz;
+		mapping->phys = phys;
+		mapping->borrowed = 1;
+		return v;
+	}
+
 	page_size = system_page_size();
 
 	mapping->virt = NULL;
+	mapping->borrowed = 0;
 	mapping->offset = phys % page_size;
 	mapping->virt_size = sz + mapping->offset;
 	mapping->size = sz;
@@ -136,7 +176,8 @@ static int unmap_memory(struct mapping *mapping)
 	if (mapping->virt == NULL)
 		return -1;
 
-	munmap(mapping->virt, mapping->virt_size);
+	if (!mapping->borrowed)
+		munmap(mapping->virt, mapping->virt_size);
 	mapping->virt = NULL;
 	mapping->offset = 0;
 	mapping->virt_size = 0;
@@ -202,6 +243,81 @@ static u16 ipchcksum(const void *addr, unsigned size)
 	return (u16) sum;
 }
 
+/* IMD structures, see src/include/imd_private.h */
+struct imd_root_pointer {
+	uint32_t magic;
+	int32_t root_offset;
+} __packed;
+
+struct imd_entry {
+	uint32_t magic;
+	int32_t start_offset;
+	uint32_t size;
+	uint32_t id;
+} __packed;
+
+struct imd_root {
+	uint32_t max_entries;
+	uint32_t num_entries;
+	uint32_t flags;
+	uint32_t entry_align;
+	int32_t max_offset;
+	struct imd_entry entries[0];
+} __packed;
+
+#define IMD_ROOT_PTR_MAGIC	0xc0389481
+#define IMD_ENTRY_MAGIC		(~0xc0389481)
+
+/* Upper limit of the IMD in the CBMEM window, 0 if CBMEM isn't mapped at once. */
+static u64 imd_limit;
+
+/*
+ * Find a cbmem entry by walking the IMD directory that ends at limit in place.
+ * The small region is an IMD of its own and is searched as well.
+ */
+static int imd_find_entry(u64 limit, uint32_t id, uint64_t *addr, size_t *size,
+			  int nested)
+{
+	const struct imd_root_pointer *rp;
+	const struct imd_root *r;
+	u64 root;
+
+	rp = window_lookup(limit - sizeof(*rp), sizeof(*rp));
+	if (!rp || rp->magic != IMD_ROOT_PTR_MAGIC)
+		return -1;
+
+	root = limit - sizeof(*rp) + rp->root_offset;
+	r = window_lookup(root, sizeof(*r));
+	if (!r || root >= limit ||
+	    r->num_entries > (limit - root) / sizeof(r->entries[0]))
+		return -1;
+
+	r = window_lookup(root, sizeof(*r) +
+			  r->num_entries * sizeof(r->entries[0]));
+	if (!r)
+		return -1;
+
+	for (uint32_t i = 0; i < r->num_entries; i++) {
+		const struct imd_entry *e = &r->entries[i];
+		u64 start = root + e->start_offset;
+
+		if (e->magic != IMD_ENTRY_MAGIC)
+			continue;
+
+		if (e->id == id) {
+			*addr = start;
+			*size = e->size;
+			return 0;
+		}
+
+		if (e->id == CBMEM_ID_IMD_SMALL && !nested &&
+		    !imd_find_entry(start + e->size, id, addr, size, 1))
+			return 0;
+	}
+
+	return -1;
+}
+
 /* Find the first cbmem entry filling in the details. */
 static int find_cbmem_entry(uint32_t id, uint64_t *addr, size_t *size)
 {
@@ -209,6 +325,9 @@ static int find_cbmem_entry(uint32_t id, uint64_t *addr, size_t *size)
 	size_t offset;
 	int ret = -1;
 
+	if (imd_limit && !imd_find_entry(imd_limit, id, addr, size, 0))
+		return 0;
+
 	table = mapping_virt(&lbtable_mapping);
 
 	if (table == NULL)
@@ -415,10 +534,12 @@ static int parse_cbtable(u64 address, size_t table_size)
 		 * Table parsing succeeded. If forwarding table not found update
 		 * coreboot table mapping for future use.
 		 */
-		if (ret == 0)
+		if (ret == 0) {
 			lbtable_mapping = table_mapping;
-		else
+			lbtable_header_addr = address + i;
+		} else {
 			unmap_memory(&table_mapping);
+		}
 
 		return 0;
 	}
@@ -706,6 +827,65 @@ static void dump_tcpa_log(void)
 	unmap_memory(&tcpa_mapping);
 }
 
+/* dump the SMI latency log, oldest SMI first */
+static void dump_smi_latency(void)
+{
+	const struct smi_latency_log *log;
+	struct mapping smi_mapping;
+	uint64_t start;
+	size_t size;
+	uint32_t max_entries, num_entries, i;
+	u64 duration, total = 0, longest = 0;
+
+	if (find_cbmem_entry(CBMEM_ID_SMI_LATENCY, &start, &size)) {
+		fprintf(stderr, "No SMI latency log found in coreboot table.\n");
+		return;
+	}
+
+	if (size < sizeof(*log))
+		die("SMI latency log is truncated\n");
+
+	log = map_memory(&smi_mapping, start, size);
+	if (!log)
+		die("Unable to map SMI latency log\n");
+
+	max_entries = (size - sizeof(*log)) / sizeof(log->entries[0]);
+	if (log->max_entries < max_entries)
+		max_entries = log->max_entries;
+	num_entries = log->num_recorded;
+	if (num_entries > max_entries)
+		num_entries = max_entries;
+
+	timestamp_set_tick_freq(log->tick_freq_mhz);
+
+	printf("%u SMIs since boot, showing the last %u:\n\n",
+	       log->num_recorded, num_entries);
+	printf("%20s %4s %10s %12s\n", "start (us)", "cpu", "source", "duration (us)");
+
+	for (i = log->num_recorded - num_entries; i != log->num_recorded; i++) {
+		const struct smi_latency_entry *e = &log->entries[i % max_entries];
+
+		duration = arch_convert_raw_ts_entry(e->end - e->start);
+		total += duration;
+		if (duration > longest)
+			longest = duration;
+
+		printf("%20" PRIu64 " %4u 0x%08x %12" PRIu64 "\n",
+		       arch_convert_raw_ts_entry(e->start), e->cpu, e->source,
+		       duration);
+	}
+
+	if (num_entries) {
+		printf("\nAverage: ");
+		print_norm(total / num_entries);
+		printf(" us, longest: ");
+		print_norm(longest);
+		printf(" us\n");
+	}
+
+	unmap_memory(&smi_mapping);
+}
+
 struct cbmem_console {
 	u32 size;
 	u32 cursor;
@@ -715,17 +895,21 @@ struct cbmem_console {
 #define CBMC_CURSOR_MASK ((1 << 28) - 1)
 #define CBMC_OVERFLOW (1 << 31)
 
-/* dump the cbmem console */
-static void dump_console(int one_boot_only)
+/* Poll interval of --follow */
+#define CBMC_FOLLOW_US 100000
+
+/* dump the cbmem console, returns the cursor of the dumped contents */
+static u32 dump_console(int one_boot_only)
 {
 	const struct cbmem_console *console_p;
 	char *console_c;
 	size_t size, cursor;
 	struct mapping console_mapping;
+	u32 seen;
 
 	if (console.tag != LB_TAG_CBMEM_CONSOLE) {
 		fprintf(stderr, "No console found in coreboot table.\n");
-		return;
+		return 0;
 	}
 
 	size = sizeof(*console_p);
@@ -733,6 +917,7 @@ static void dump_console(int one_boot_only)
 	if (!console_p)
 		die("Unable to map console object.\n");
 
+	seen = console_p->cursor;
 	cursor = console_p->cursor & CBMC_CURSOR_MASK;
 	if (!(console_p->cursor & CBMC_OVERFLOW) && cursor < console_p->size)
 		size = cursor;
@@ -805,6 +990,94 @@ static void dump_console(int one_boot_only)
 	puts(console_c + cursor);
 	free(console_c);
 	unmap_memory(&console_mapping);
+
+	return seen;
+}
+
+/* Print body[start, end) of the console, without copying more than a page at once. */
+static void print_console_range(const struct cbmem_console *console_p,
+				size_t start, size_t end)
+{
+	char buf[4096];
+
+	while (start < end) {
+		size_t n = end - start;
+
+		if (n > sizeof(buf))
+			n = sizeof(buf);
+
+		aligned_memcpy(buf, console_p->body + start, n);
+		for (size_t i = 0; i < n; i++)
+			if (!isprint(buf[i]) && !isspace(buf[i]))
+				buf[i] = '?';
+		fwrite(buf, 1, n, stdout);
+		start += n;
+	}
+}
+
+/*
+ * Like tail -f: keep the console mapped and print what gets appended after
+ * the cursor 'seen'. Only the new bytes are read on each poll.
+ */
+static void follow_console(u32 seen)
+{
+	const struct cbmem_console *console_p;
+	struct mapping console_mapping;
+	size_t size, prev;
+
+	if (console.tag != LB_TAG_CBMEM_CONSOLE)
+		return;
+
+	console_p = map_memory(&console_mapping, console.cbmem_addr,
+			       sizeof(*console_p));
+	if (!console_p)
+		die("Unable to map console object.\n");
+	size = console_p->size;
+	unmap_memory(&console_mapping);
+
+	console_p = map_memory(&console_mapping, console.cbmem_addr,
+			       size + sizeof(*console_p));
+	if (!console_p)
+		die("Unable to map full console object.\n");
+
+	prev = seen & CBMC_CURSOR_MASK;
+	if (prev >= size)
+		prev = 0;
+
+	for (;;) {
+		u32 raw;
+		size_t cursor;
+
+		usleep(CBMC_FOLLOW_US);
+
+		/* Firmware updates the cursor behind our back. */
+		raw = *(const volatile u32 *)&console_p->cursor;
+		cursor = raw & CBMC_CURSOR_MASK;
+
+		/* Illegal, wait for the firmware to fix it up. */
+		if (cursor >= size)
+			continue;
+
+		if (!(raw & CBMC_OVERFLOW) &&
+		    (cursor < prev || (seen & CBMC_OVERFLOW))) {
+			/* The console was cleared. */
+			print_console_range(console_p, 0, cursor);
+		} else if (cursor >= prev && !((raw ^ seen) & CBMC_OVERFLOW)) {
+			print_console_range(console_p, prev, cursor);
+		} else {
+			/* Wrapped around, maybe even past what we printed last. */
+			if (cursor >= prev) {
+				fprintf(stderr, "cbmem: console overflowed, some output was lost\n");
+				prev = cursor;
+			}
+			print_console_range(console_p, prev, size);
+			print_console_range(console_p, 0, cursor);
+		}
+
+		fflush(stdout);
+		seen = raw;
+		prev = cursor;
+	}
 }
 
 static void hexdump(unsigned long memory, int length)
@@ -1067,6 +1340,206 @@ static void dump_coverage(void)
 	unmap_memory(&coverage_mapping);
 }
 
+/* Map all of CBMEM at once, the dump functions then use it instead of mapping their data. */
+static void map_cbmem_window(void)
+{
+	u64 start = unpack_lb64(cbmem.start);
+	u64 size = unpack_lb64(cbmem.size);
+
+	if (cbmem.type != LB_MEM_TABLE)
+		return;
+
+	if (!map_memory(&windows[0], start, size)) {
+		debug("Unable to map CBMEM at once, mapping entries one by one.\n");
+		return;
+	}
+
+	num_windows = 1;
+	imd_limit = start + size;
+}
+
+/*
+ * A snapshot holds the coreboot table and the cbmem entries decoded by this
+ * tool, so they can be decoded later, e.g. on another machine. It consists of
+ * a header, a record for each entry and the entry data, 16 byte aligned. All
+ * fields are in the byte order of the machine the snapshot was taken on.
+ */
+#define SNAPSHOT_MAGIC		"CBMEMSNP"
+#define SNAPSHOT_VERSION	1
+#define SNAPSHOT_ALIGN		16
+
+struct snapshot_header {
+	char magic[8];
+	u32 version;
+	u32 num_records;
+} __packed;
+
+struct snapshot_record {
+	/* cbmem ID, CBMEM_ID_CBTABLE for the coreboot table and its header */
+	u32 id;
+	u32 size;
+	u64 phys;
+	/* Offset of the data from the start of the snapshot */
+	u64 offset;
+} __packed;
+
+static const uint32_t snapshot_ids[] = {
+	CBMEM_ID_CONSOLE,
+	CBMEM_ID_TIMESTAMP,
+	CBMEM_ID_TCPA_LOG,
+	CBMEM_ID_SMI_LATENCY,
+};
+
+static struct mapping snapshot_mapping;
+
+static void write_all(int fd, const void *buf, size_t len)
+{
+	const u8 *p = buf;
+
+	while (len) {
+		ssize_t n = write(fd, p, len);
+
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0) {
+			fprintf(stderr, "Failed to write snapshot: %s\n",
+				strerror(errno));
+			exit(1);
+		}
+		p += n;
+		len -= n;
+	}
+}
+
+/* Writes the entries straight from their mappings, "-" writes to stdout. */
+static void write_snapshot(const char *path)
+{
+	static const u8 zeroes[SNAPSHOT_ALIGN];
+	struct snapshot_header header;
+	struct snapshot_record records[ARRAY_SIZE(snapshot_ids) + 1];
+	struct mapping mappings[ARRAY_SIZE(records)];
+	u32 n = 0;
+	u64 offset;
+	int fd;
+
+	records[n].id = CBMEM_ID_CBTABLE;
+	records[n].phys = lbtable_header_addr;
+	records[n].size = lbtable_mapping.phys + mapping_size(&lbtable_mapping) -
+			  lbtable_header_addr;
+	n++;
+
+	for (size_t i = 0; i < ARRAY_SIZE(snapshot_ids); i++) {
+		uint64_t start;
+		size_t size;
+
+		if (find_cbmem_entry(snapshot_ids[i], &start, &size))
+			continue;
+
+		records[n].id = snapshot_ids[i];
+		records[n].phys = start;
+		records[n].size = size;
+		n++;
+	}
+
+	offset = sizeof(header) + n * sizeof(records[0]);
+	for (u32 i = 0; i < n; i++) {
+		if (!map_memory(&mappings[i], records[i].phys, records[i].size))
+			die("Unable to map snapshot entry\n");
+		offset = (offset + SNAPSHOT_ALIGN - 1) & ~(u64)(SNAPSHOT_ALIGN - 1);
+		records[i].offset = offset;
+		offset += records[i].size;
+	}
+
+	if (!strcmp(path, "-")) {
+		fd = STDOUT_FILENO;
+	} else {
+		fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0) {
+			fprintf(stderr, "Could not open %s: %s\n", path,
+				strerror(errno));
+			exit(1);
+		}
+	}
+
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.num_records = n;
+	write_all(fd, &header, sizeof(header));
+	write_all(fd, records, n * sizeof(records[0]));
+
+	offset = sizeof(header) + n * sizeof(records[0]);
+	for (u32 i = 0; i < n; i++) {
+		write_all(fd, zeroes, records[i].offset - offset);
+		write_all(fd, mapping_virt(&mappings[i]), records[i].size);
+		offset = records[i].offset + records[i].size;
+		unmap_memory(&mappings[i]);
+	}
+
+	if (fd != STDOUT_FILENO && close(fd)) {
+		fprintf(stderr, "Failed to write snapshot: %s\n",
+			strerror(errno));
+		exit(1);
+	}
+}
+
+/* Makes the records of a snapshot the only memory available to the dump functions. */
+static void read_snapshot(const char *path)
+{
+	const struct snapshot_header *header;
+	const struct snapshot_record *records;
+	const u8 *base;
+	struct stat st;
+	size_t size;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st)) {
+		fprintf(stderr, "Could not open %s: %s\n", path,
+			strerror(errno));
+		exit(1);
+	}
+
+	size = st.st_size;
+	if (size < sizeof(*header))
+		die("Snapshot is truncated\n");
+
+	base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED)
+		die("Unable to map snapshot\n");
+
+	snapshot_mapping.virt = (void *)base;
+	snapshot_mapping.virt_size = size;
+	snapshot_mapping.size = size;
+
+	header = (const void *)base;
+	records = (const void *)(header + 1);
+	if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) ||
+	    header->version != SNAPSHOT_VERSION)
+		die("Not a cbmem snapshot\n");
+	if (header->num_records > ARRAY_SIZE(windows) ||
+	    size < sizeof(*header) + header->num_records * sizeof(*records))
+		die("Snapshot is corrupt\n");
+
+	for (u32 i = 0; i < header->num_records; i++) {
+		struct mapping *w = &windows[num_windows++];
+
+		if (records[i].offset > size ||
+		    records[i].size > size - records[i].offset)
+			die("Snapshot is corrupt\n");
+
+		w->virt = (void *)(base + records[i].offset);
+		w->offset = 0;
+		w->virt_size = records[i].size;
+		w->phys = records[i].phys;
+		w->size = records[i].size;
+		w->borrowed = 1;
+
+		if (records[i].id == CBMEM_ID_CBTABLE)
+			parse_cbtable(w->phys, w->size);
+	}
+}
+
 static void print_version(void)
 {
 	printf("cbmem v%s -- ", CBMEM_VERSION);
@@ -1083,10 +1556,11 @@ static void print_version(void)
 
 static void print_usage(const char *name, int exit_code)
 {
-	printf("usage: %s [-cCltTLxVvh?]\n", name);
+	printf("usage: %s [-c1FCltTLSxVvh?] [-s FILE] [-f FILE]\n", name);
 	printf("\n"
 	     "   -c | --console:                   print cbmem console\n"
 	     "   -1 | --oneboot:                   print cbmem console for last boot only\n"
+	     "   -F | --follow:                    print cbmem console, then what gets appended to it\n"
 	     "   -C | --coverage:                  dump coverage information\n"
 	     "   -l | --list:                      print cbmem table of contents\n"
 	     "   -x | --hexdump:                   print hexdump of cbmem area\n"
@@ -1094,6 +1568,10 @@ static void print_usage(const char *name, int exit_code)
 	     "   -t | --timestamps:                print timestamp information\n"
 	     "   -T | --parseable-timestamps:      print parseable timestamps\n"
 	     "   -L | --tcpa-log                   print TCPA log\n"
+	     "   -S | --smi-latency                print SMI latency log\n"
+	     "   -s | --snapshot FILE:             save the coreboot table, console, timestamps\n"
+	     "                                     and logs to FILE (- for stdout) for offline decoding\n"
+	     "   -f | --from-snapshot FILE:        decode a snapshot instead of this machine's memory\n"
 	     "   -V | --verbose:                   verbose (debugging) output\n"
 	     "   -v | --version:                   print the version\n"
 	     "   -h | --help:                      print this help\n"
@@ -1216,6 +1694,81 @@ static char *dt_find_compat(const char *parent, const char *compat,
 }
 #endif /* defined(__arm__) || defined(__aarch64__) */
 
+/* Open /dev/mem and find the coreboot table. Return < 0 on error. */
+static int find_cbtable(void)
+{
+	mem_fd = open("/dev/mem", O_RDONLY, 0);
+	if (mem_fd < 0) {
+		fprintf(stderr, "Failed to gain memory access: %s\n",
+			strerror(errno));
+		return -1;
+	}
+
+#if defined(__arm__) || defined(__aarch64__)
+	int addr_cells, size_cells;
+	char *coreboot_node = dt_find_compat("/proc/device-tree", "coreboot",
+					     &addr_cells, &size_cells);
+
+	if (!coreboot_node) {
+		fprintf(stderr, "Could not find 'coreboot' compatible node!\n");
+		return -1;
+	}
+
+	if (addr_cells < 0) {
+		fprintf(stderr, "Warning: no #address-cells node in tree!\n");
+		addr_cells = 1;
+	}
+
+	int nlen = strlen(coreboot_node);
+	char *reg = alloca(nlen + sizeof("/reg"));
+
+	strcpy(reg, coreboot_node);
+	strcpy(reg + nlen, "/reg");
+	free(coreboot_node);
+
+	int fd = open(reg, O_RDONLY);
+	if (fd < 0) {
+		perror(reg);
+		return -1;
+	}
+
+	int i;
+	size_t size_to_read = addr_cells * 4 + size_cells * 4;
+	u8 *dtbuffer = alloca(size_to_read);
+	if (read(fd, dtbuffer, size_to_read) < 0) {
+		perror(reg);
+		return -1;
+	}
+	close(fd);
+
+	/* No variable-length byte swap function anywhere in C... how sad. */
+	u64 baseaddr = 0;
+	for (i = 0; i < addr_cells * 4; i++) {
+		baseaddr <<= 8;
+		baseaddr |= *dtbuffer;
+		dtbuffer++;
+	}
+	u64 cb_table_size = 0;
+	for (i = 0; i < size_cells * 4; i++) {
+		cb_table_size <<= 8;
+		cb_table_size |= *dtbuffer;
+		dtbuffer++;
+	}
+
+	parse_cbtable(baseaddr, cb_table_size);
+#else
+	unsigned long long possible_base_addresses[] = { 0, 0xf0000 };
+
+	/* Find and parse coreboot table */
+	for (size_t j = 0; j < ARRAY_SIZE(possible_base_addresses); j++) {
+		if (!parse_cbtable(possible_base_addresses[j], 0))
+			break;
+	}
+#endif
+
+	return 0;
+}
+
 int main(int argc, char** argv)
 {
 	int print_defaults = 1;
@@ -1226,27 +1779,36 @@ int main(int argc, char** argv)
 	int print_rawdump = 0;
 	int print_timestamps = 0;
 	int print_tcpa_log = 0;
+	int print_smi_latency = 0;
 	int machine_readable_timestamps = 0;
 	int one_boot_only = 0;
+	int follow = 0;
+	u32 console_seen = 0;
 	unsigned int rawdump_id = 0;
+	const char *snapshot_out = NULL;
+	const char *snapshot_in = NULL;
 
 	int opt, option_index = 0;
 	static struct option long_options[] = {
 		{"console", 0, 0, 'c'},
 		{"oneboot", 0, 0, '1'},
+		{"follow", 0, 0, 'F'},
 		{"coverage", 0, 0, 'C'},
 		{"list", 0, 0, 'l'},
 		{"tcpa-log", 0, 0, 'L'},
+		{"smi-latency", 0, 0, 'S'},
 		{"timestamps", 0, 0, 't'},
 		{"parseable-timestamps", 0, 0, 'T'},
 		{"hexdump", 0, 0, 'x'},
 		{"rawdump", required_argument, 0, 'r'},
+		{"snapshot", required_argument, 0, 's'},
+		{"from-snapshot", required_argument, 0, 'f'},
 		{"verbose", 0, 0, 'V'},
 		{"version", 0, 0, 'v'},
 		{"help", 0, 0, 'h'},
 		{0, 0, 0, 0}
 	};
-	while ((opt = getopt_long(argc, argv, "c1CltTLxVvh?r:",
+	while ((opt = getopt_long(argc, argv, "c1FCltTLSxVvh?r:s:f:",
 				  long_options, &option_index)) != EOF) {
 		switch (opt) {
 		case 'c':
@@ -1258,6 +1820,11 @@ int main(int argc, char** argv)
 			one_boot_only = 1;
 			print_defaults = 0;
 			break;
+		case 'F':
+			print_console = 1;
+			follow = 1;
+			print_defaults = 0;
+			break;
 		case 'C':
 			print_coverage = 1;
 			print_defaults = 0;
@@ -1270,6 +1837,10 @@ int main(int argc, char** argv)
 			print_tcpa_log = 1;
 			print_defaults = 0;
 			break;
+		case 'S':
+			print_smi_latency = 1;
+			print_defaults = 0;
+			break;
 		case 'x':
 			print_hexdump = 1;
 			print_defaults = 0;
@@ -1279,6 +1850,13 @@ int main(int argc, char** argv)
 			print_defaults = 0;
 			rawdump_id = strtoul(optarg, NULL, 16);
 			break;
+		case 's':
+			snapshot_out = optarg;
+			print_defaults = 0;
+			break;
+		case 'f':
+			snapshot_in = optarg;
+			break;
 		case 't':
 			print_timestamps = 1;
 			print_defaults = 0;
@@ -1310,80 +1888,35 @@ int main(int argc, char** argv)
 		print_usage(argv[0], 1);
 	}
 
-	mem_fd = open("/dev/mem", O_RDONLY, 0);
-	if (mem_fd < 0) {
-		fprintf(stderr, "Failed to gain memory access: %s\n",
-			strerror(errno));
-		return 1;
-	}
-
-#if defined(__arm__) || defined(__aarch64__)
-	int addr_cells, size_cells;
-	char *coreboot_node = dt_find_compat("/proc/device-tree", "coreboot",
-					     &addr_cells, &size_cells);
-
-	if (!coreboot_node) {
-		fprintf(stderr, "Could not find 'coreboot' compatible node!\n");
-		return 1;
-	}
-
-	if (addr_cells < 0) {
-		fprintf(stderr, "Warning: no #address-cells node in tree!\n");
-		addr_cells = 1;
-	}
-
-	int nlen = strlen(coreboot_node);
-	char *reg = alloca(nlen + sizeof("/reg"));
-
-	strcpy(reg, coreboot_node);
-	strcpy(reg + nlen, "/reg");
-	free(coreboot_node);
-
-	int fd = open(reg, O_RDONLY);
-	if (fd < 0) {
-		perror(reg);
+	if (snapshot_out && !strcmp(snapshot_out, "-") && (print_console ||
+	    print_coverage || print_list || print_hexdump || print_rawdump ||
+	    print_timestamps || print_tcpa_log || print_smi_latency)) {
+		fprintf(stderr, "Error: Can't print while writing a snapshot to stdout.\n");
 		return 1;
 	}
 
-	int i;
-	size_t size_to_read = addr_cells * 4 + size_cells * 4;
-	u8 *dtbuffer = alloca(size_to_read);
-	if (read(fd, dtbuffer, size_to_read) < 0) {
-		perror(reg);
+	if (snapshot_in && follow) {
+		fprintf(stderr, "Error: Can't follow the console of a snapshot.\n");
 		return 1;
 	}
-	close(fd);
-
-	/* No variable-length byte swap function anywhere in C... how sad. */
-	u64 baseaddr = 0;
-	for (i = 0; i < addr_cells * 4; i++) {
-		baseaddr <<= 8;
-		baseaddr |= *dtbuffer;
-		dtbuffer++;
-	}
-	u64 cb_table_size = 0;
-	for (i = 0; i < size_cells * 4; i++) {
-		cb_table_size <<= 8;
-		cb_table_size |= *dtbuffer;
-		dtbuffer++;
-	}
-
-	parse_cbtable(baseaddr, cb_table_size);
-#else
-	unsigned long long possible_base_addresses[] = { 0, 0xf0000 };
 
-	/* Find and parse coreboot table */
-	for (size_t j = 0; j < ARRAY_SIZE(possible_base_addresses); j++) {
-		if (!parse_cbtable(possible_base_addresses[j], 0))
-			break;
+	if (snapshot_in) {
+		read_snapshot(snapshot_in);
+	} else {
+		if (find_cbtable() < 0)
+			return 1;
+		if (mapping_virt(&lbtable_mapping) != NULL)
+			map_cbmem_window();
 	}
-#endif
 
 	if (mapping_virt(&lbtable_mapping) == NULL)
 		die("Table not found.\n");
 
+	if (snapshot_out)
+		write_snapshot(snapshot_out);
+
 	if (print_console)
-		dump_console(one_boot_only);
+		console_seen = dump_console(one_boot_only);
 
 	if (print_coverage)
 		dump_coverage();
@@ -1403,8 +1936,18 @@ int main(int argc, char** argv)
 	if (print_tcpa_log)
 		dump_tcpa_log();
 
+	if (print_smi_latency)
+		dump_smi_latency();
+
+	if (follow)
+		follow_console(console_seen);
+
 	unmap_memory(&lbtable_mapping);
+	for (size_t i = 0; i < num_windows; i++)
+		unmap_memory(&windows[i]);
+	unmap_memory(&snapshot_mapping);
 
-	close(mem_fd);
+	if (mem_fd >= 0)
+		close(mem_fd);
 	return 0;
 }
@@ -11,6 +11,7 @@
 #include <sys/stat.h>
 #include <commonlib/helpers.h>
 #include <fmap.h>
+#include "batch.h"
 #include "ifdtool.h"
 
 #ifndef O_BINARY
@@ -34,6 +35,10 @@ static unsigned int max_regions = 0;
 static int selected_chip = 0;
 static int platform = -1;
 
+/* Image loaded once by a batch, shared with the processes building its variants */
+static char *batch_image;
+static int batch_image_size;
+
 static const struct region_name region_names[MAX_REGIONS] = {
 	{ "Flash Descriptor", "fd", "flashregion_0_flashdescriptor.bin", "SI_DESC" },
 	{ "BIOS", "bios", "flashregion_1_bios.bin", "SI_BIOS" },
@@ -1584,6 +1589,63 @@ static void new_layout(const char *filename, char *image, int size,
 	free(new_image);
 }
 
+static char *read_image(const char *filename, int *size)
+{
+	int bios_fd = open(filename, O_RDONLY | O_BINARY);
+	if (bios_fd == -1) {
+		perror("Could not open file");
+		exit(EXIT_FAILURE);
+	}
+	struct stat buf;
+	if (fstat(bios_fd, &buf) == -1) {
+		perror("Could not stat file");
+		exit(EXIT_FAILURE);
+	}
+	*size = buf.st_size;
+
+	printf("File %s is %d bytes\n", filename, *size);
+
+	char *image = malloc(*size);
+	if (!image) {
+		printf("Out of memory.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (read(bios_fd, image, *size) != *size) {
+		perror("Could not read file");
+		exit(EXIT_FAILURE);
+	}
+
+	close(bios_fd);
+
+	return image;
+}
+
+int main(int argc, char *argv[]);
+
+/*
+ * Runs in a child process for each line of a batch manifest, as
+ * "ifdtool -O <output> [options] <filename>" on the image the batch loaded.
+ */
+static int build_variant(int argc, char *argv[], void *filename)
+{
+	static char output_opt[] = "-O";
+	char **args = calloc(argc + 3, sizeof(*args));
+
+	if (!args) {
+		printf("Out of memory.\n");
+		return EXIT_FAILURE;
+	}
+
+	args[0] = argv[0];
+	args[1] = output_opt;
+	args[2] = argv[1];
+	memcpy(&args[3], &argv[2], (argc - 2) * sizeof(*args));
+	args[argc + 1] = filename;
+
+	return main(argc + 2, args);
+}
+
 static void print_version(void)
 {
 	printf("ifdtool v%s -- ", IFDTOOL_VERSION);
@@ -1633,6 +1695,9 @@ static void print_usage(const char *name)
 	       "                                         tgl    - Tiger Lake\n"
 	       "   -S | --setpchstrap                    Write a PCH strap\n"
 	       "   -V | --newvalue                       The new value to write into PCH strap specified by -S\n"
+	       "   -B | --batch <manifest>               Build a variant of the image for each line of the\n"
+	       "                                         manifest, written as \"<output> [options]\"\n"
+	       "   -j | --jobs <n>                       Number of variants to build at once (default: one per CPU)\n"
 	       "   -v | --version:                       print the version\n"
 	       "   -h | --help:                          print this help\n\n"
 	       "<region> is one of Descriptor, BIOS, ME, GbE, Platform, res1, res2, res3\n"
@@ -1648,6 +1713,8 @@ int main(int argc, char *argv[])
 	int mode_read = 0, mode_altmedisable = 0, altmedisable = 0;
 	char *region_type_string = NULL, *region_fname = NULL;
 	const char *layout_fname = NULL;
+	const char *batch_manifest = NULL;
+	unsigned int batch_jobs = 0;
 	char *new_filename = NULL;
 	int region_type = -1, inputfreq = 0;
 	unsigned int value = 0;
@@ -1676,10 +1743,12 @@ int main(int argc, char *argv[])
 		{"validate", 0, NULL, 't'},
 		{"setpchstrap", 1, NULL, 'S'},
 		{"newvalue", 1, NULL, 'V'},
+		{"batch", 1, NULL, 'B'},
+		{"jobs", 1, NULL, 'j'},
 		{0, 0, 0, 0}
 	};
 
-	while ((opt = getopt_long(argc, argv, "S:V:df:D:C:M:xi:n:O:s:p:elruvth?",
+	while ((opt = getopt_long(argc, argv, "S:V:df:D:C:M:xi:n:O:s:p:elruvthB:j:?",
 				  long_options, &option_index)) != EOF) {
 		switch (opt) {
 		case 'd':
@@ -1891,6 +1960,12 @@ int main(int argc, char *argv[])
 		case 't':
 			mode_validate = 1;
 			break;
+		case 'B':
+			batch_manifest = optarg;
+			break;
+		case 'j':
+			batch_jobs = strtoul(optarg, NULL, 0);
+			break;
 		case 'v':
 			print_version();
 			exit(EXIT_SUCCESS);
@@ -1899,7 +1974,8 @@ int main(int argc, char *argv[])
 		case '?':
 		default:
 			print_usage(argv[0]);
-			exit(EXIT_SUCCESS);
+			/* A typo in a manifest line must not pass as a built variant. */
+			exit(batch_image ? EXIT_FAILURE : EXIT_SUCCESS);
 			break;
 		}
 	}
@@ -1912,14 +1988,25 @@ int main(int argc, char *argv[])
 		exit(EXIT_FAILURE);
 	}
 
-	if ((mode_dump + mode_layout + mode_extract + mode_inject + mode_setstrap +
-	     mode_newlayout + mode_spifreq + mode_em100 + mode_locked +
-	     mode_unlocked + mode_density + mode_altmedisable + mode_validate) == 0) {
-		fprintf(stderr, "You need to specify a mode.\n\n");
+	int modes = mode_dump + mode_layout + mode_extract + mode_inject +
+		    mode_setstrap + mode_newlayout + mode_spifreq + mode_em100 +
+		    mode_locked + mode_unlocked + mode_density + mode_altmedisable +
+		    mode_validate;
+
+	if (!modes == !batch_manifest) {
+		if (batch_manifest)
+			fprintf(stderr, "The modes of a batch are set in its manifest.\n\n");
+		else
+			fprintf(stderr, "You need to specify a mode.\n\n");
 		print_usage(argv[0]);
 		exit(EXIT_FAILURE);
 	}
 
+	if (batch_manifest && batch_image) {
+		fprintf(stderr, "Batches can't be nested.\n");
+		exit(EXIT_FAILURE);
+	}
+
 	if (optind + 1 != argc) {
 		fprintf(stderr, "You need to specify a file.\n\n");
 		print_usage(argv[0]);
@@ -1927,33 +2014,16 @@ int main(int argc, char *argv[])
 	}
 
 	char *filename = argv[optind];
-	int bios_fd = open(filename, O_RDONLY | O_BINARY);
-	if (bios_fd == -1) {
-		perror("Could not open file");
-		exit(EXIT_FAILURE);
-	}
-	struct stat buf;
-	if (fstat(bios_fd, &buf) == -1) {
-		perror("Could not stat file");
-		exit(EXIT_FAILURE);
-	}
-	int size = buf.st_size;
-
-	printf("File %s is %d bytes\n", filename, size);
-
-	char *image = malloc(size);
-	if (!image) {
-		printf("Out of memory.\n");
-		exit(EXIT_FAILURE);
-	}
+	char *image;
+	int size;
 
-	if (read(bios_fd, image, size) != size) {
-		perror("Could not read file");
-		exit(EXIT_FAILURE);
+	if (batch_image) {
+		image = batch_image;
+		size = batch_image_size;
+	} else {
+		image = read_image(filename, &size);
 	}
 
-	close(bios_fd);
-
 	// generate new filename
 	if (new_filename == NULL) {
 		new_filename = (char *) malloc((strlen(filename) + 5) * sizeof(char));
@@ -1968,6 +2038,17 @@ int main(int argc, char *argv[])
 
 	check_ifd_version(image, size);
 
+	if (batch_manifest) {
+		batch_image = image;
+		batch_image_size = size;
+		if (batch_run(batch_manifest, argv[0], batch_jobs,
+			      build_variant, filename))
+			exit(EXIT_FAILURE);
+		free(new_filename);
+		free(image);
+		return 0;
+	}
+
 	if (mode_dump)
 		dump_fd(image, size);
 
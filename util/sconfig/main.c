@@ -1323,6 +1323,96 @@ static void expose_device_names(FILE *fil, FILE *head, struct device *ptr, struc
 	}
 }
 
+/*
+ * Devices on the PCI root bus by devfn, for pcidev_path_on_root(). Index 0 is
+ * unused so that a zero in the emitted devfn index means "not present".
+ */
+static struct device *pci_root_devs[256] = { NULL };
+static int pci_root_dev_count = 1;
+static uint8_t pci_root_devfn_index[256];
+
+/* First device of each path type in all_devices order, for dev_find_path(). */
+static struct {
+	char type[32];
+	struct device *dev;
+} first_dev_of_path_type[32];
+static int path_type_count;
+
+static void collect_lookup_tables(FILE *fil, FILE *head, struct device *ptr,
+				  struct device *next)
+{
+	/* Same bus pci_root_bus() picks: first link of the first domain. */
+	static struct bus *pci_root;
+	char type[32];
+	int devfn, i;
+
+	if (sscanf(ptr->path, " .type = %31[A-Z0-9_]", type) == 1) {
+		for (i = 0; i < path_type_count; i++) {
+			if (!strcmp(first_dev_of_path_type[i].type, type))
+				break;
+		}
+		if (i == path_type_count && i < ARRAY_SIZE(first_dev_of_path_type)) {
+			strcpy(first_dev_of_path_type[i].type, type);
+			first_dev_of_path_type[i].dev = ptr;
+			path_type_count++;
+		}
+	}
+
+	if (!pci_root && ptr->bustype == DOMAIN) {
+		pci_root = ptr->bus;
+		return;
+	}
+
+	if (!pci_root || ptr->parent != pci_root || ptr->bustype != PCI)
+		return;
+
+	/* find_dev_path() returns the first sibling that matches. */
+	devfn = ((ptr->path_a & 0x1f) << 3) | (ptr->path_b & 0x7);
+	if (pci_root_devfn_index[devfn])
+		return;
+
+	if (pci_root_dev_count == ARRAY_SIZE(pci_root_devs)) {
+		fprintf(stderr, "ERROR: Too many devices on the PCI root bus\n");
+		exit(1);
+	}
+
+	pci_root_devs[pci_root_dev_count] = ptr;
+	pci_root_devfn_index[devfn] = pci_root_dev_count++;
+}
+
+static void emit_lookup_tables(FILE *fil, FILE *head)
+{
+	int i;
+
+	fprintf(head, "\n/* lookup tables, see src/device/device_const.c */\n");
+	fprintf(head, "extern DEVTREE_CONST struct device *const __pci_root_devs[];\n");
+	fprintf(head, "extern const uint8_t __pci_root_devfn_index[256];\n");
+	fprintf(head, "extern DEVTREE_CONST struct device *const "
+		"__first_dev_of_path_type[DEVICE_PATH_TYPES];\n");
+
+	fprintf(fil, "\n/* lookup tables */\n");
+	fprintf(fil, "DEVTREE_CONST struct device *const __pci_root_devs[] = {\n");
+	fprintf(fil, "\tNULL,\n");
+	for (i = 1; i < pci_root_dev_count; i++)
+		fprintf(fil, "\t&%s,\n", pci_root_devs[i]->name);
+	fprintf(fil, "};\n");
+
+	fprintf(fil, "const uint8_t __pci_root_devfn_index[256] = {\n");
+	for (i = 0; i < ARRAY_SIZE(pci_root_devfn_index); i++) {
+		if (pci_root_devfn_index[i])
+			fprintf(fil, "\t[PCI_DEVFN(0x%x, %d)] = %d,\n", i >> 3, i & 7,
+				pci_root_devfn_index[i]);
+	}
+	fprintf(fil, "};\n");
+
+	fprintf(fil, "DEVTREE_CONST struct device *const "
+		"__first_dev_of_path_type[DEVICE_PATH_TYPES] = {\n");
+	for (i = 0; i < path_type_count; i++)
+		fprintf(fil, "\t[%s] = &%s,\n", first_dev_of_path_type[i].type,
+			first_dev_of_path_type[i].dev->name);
+	fprintf(fil, "};\n");
+}
+
 static void add_siblings_to_queue(struct queue_entry **bfs_q_head,
 				  struct device *d)
 {
@@ -1884,6 +1974,8 @@ static void generate_outputd(FILE *gen, FILE *dev)
 	fprintf(dev, "#include <device/device.h>\n\n");
 	fprintf(dev, "/* expose_device_names */\n");
 	walk_device_tree(gen, dev, &base_root_dev, expose_device_names);
+	walk_device_tree(NULL, NULL, &base_root_dev, collect_lookup_tables);
+	emit_lookup_tables(gen, dev);
 	fprintf(dev, "\n#endif /* __STATIC_DEVICE_NAMES_H */\n");
 }
 